@@ -0,0 +1,312 @@
+// Title: asyncnet.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for asyncnet.h
+
+#include "asyncnet.h"
+#include <algorithm>
+#include <chrono>
+
+// Name - AsyncSatNet(SatNet& network, int capacity)
+// Desc - sets up the ring, every slot starts with its own index as its sequence, copies the network
+// into the mirror, which readers use first, and starts the writer
+AsyncSatNet::AsyncSatNet(SatNet& network, int capacity) : m_network(network) {
+    size_t size = 2;
+    while (size < size_t(capacity)) {
+        size *= 2;
+    }
+    m_ring = vector<Slot>(size);
+    for (size_t i = 0; i < size; i++) {
+        m_ring[i].seq.store(i, memory_order_relaxed);
+    }
+    m_mask = size - 1;
+    m_tail = 0;
+    m_head = 0;
+    m_sleeping = false;
+    m_stop = false;
+    m_batches = 0;
+    m_applied = 0;
+    m_mirror = network;
+    m_views[0] = &m_network;
+    m_views[1] = &m_mirror;
+    m_trace = network.getTrace();
+    m_network.recordTrace(nullptr);
+    m_published = 1;
+    m_readers[0] = 0;
+    m_readers[1] = 0;
+    m_writer = thread(&AsyncSatNet::writerLoop, this);
+}
+
+// Name - ~AsyncSatNet()
+// Desc - the writer drains the ring before it exits, so no enqueued command is lost
+AsyncSatNet::~AsyncSatNet() {
+    m_stop = true;
+    {
+        lock_guard<mutex> guard(m_sleepLock);
+    }
+    m_wake.notify_one();
+    m_writer.join();
+    m_network.recordTrace(m_trace);
+}
+
+// Name - push(Command& command)
+// Desc - Claims the next slot with a compare and swap on the tail and hands the command over by
+// publishing the slot's sequence. Yields while the ring is full.
+void AsyncSatNet::push(Command& command) {
+    size_t pos = m_tail.load(memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+        slot = &m_ring[pos & m_mask];
+        size_t seq = slot->seq.load(memory_order_acquire);
+        long long diff = (long long)seq - (long long)pos;
+        if (diff == 0) {
+            if (m_tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            // full, the writer hasn't freed the slot from the previous lap yet
+            this_thread::yield();
+            pos = m_tail.load(memory_order_relaxed);
+        }
+        else {
+            pos = m_tail.load(memory_order_relaxed);
+        }
+    }
+    slot->command = move(command);
+    slot->seq.store(pos + 1, memory_order_release);
+    if (m_sleeping.load()) {
+        lock_guard<mutex> guard(m_sleepLock);
+        m_wake.notify_one();
+    }
+}
+
+// Name - pop(Command& command)
+// Desc - takes the oldest command if its producer has finished writing it
+bool AsyncSatNet::pop(Command& command) {
+    Slot& slot = m_ring[m_head & m_mask];
+    if (slot.seq.load(memory_order_acquire) != m_head + 1) {
+        return false;
+    }
+    command = move(slot.command);
+    slot.seq.store(m_head + m_mask + 1, memory_order_release);
+    m_head++;
+    return true;
+}
+
+// Name - pushWithFuture(Command& command)
+// Desc - attaches a promise to the command, the writer fulfills and deletes it
+future<bool> AsyncSatNet::pushWithFuture(Command& command) {
+    command.result = new promise<bool>();
+    future<bool> result = command.result->get_future();
+    push(command);
+    return result;
+}
+
+// Name - insert(const Sat& satellite)
+// Desc - enqueues an insert, the future is false for an invalid or duplicate id
+future<bool> AsyncSatNet::insert(const Sat& satellite) {
+    Command command;
+    command.op = CMD_INSERT;
+    command.satellite = satellite;
+    return pushWithFuture(command);
+}
+
+// Name - remove(SatID id)
+// Desc - enqueues a remove, the future is false if there was no satellite with id
+future<bool> AsyncSatNet::remove(SatID id) {
+    Command command;
+    command.op = CMD_REMOVE;
+    command.satellite.setID(id);
+    return pushWithFuture(command);
+}
+
+// Name - setState(SatID id, STATE state)
+// Desc - enqueues a setState, the future holds setState's result
+future<bool> AsyncSatNet::setState(SatID id, STATE state) {
+    Command command;
+    command.op = CMD_SETSTATE;
+    command.satellite.setID(id);
+    command.satellite.setState(state);
+    return pushWithFuture(command);
+}
+
+// Name - insert(const Sat& satellite, function<void(bool)> done)
+// Desc - enqueues an insert, done is called on the writer thread with the result
+void AsyncSatNet::insert(const Sat& satellite, function<void(bool)> done) {
+    Command command;
+    command.op = CMD_INSERT;
+    command.satellite = satellite;
+    command.done = move(done);
+    push(command);
+}
+
+// Name - remove(SatID id, function<void(bool)> done)
+// Desc - enqueues a remove, done is called on the writer thread with the result
+void AsyncSatNet::remove(SatID id, function<void(bool)> done) {
+    Command command;
+    command.op = CMD_REMOVE;
+    command.satellite.setID(id);
+    command.done = move(done);
+    push(command);
+}
+
+// Name - setState(SatID id, STATE state, function<void(bool)> done)
+// Desc - enqueues a setState, done is called on the writer thread with the result
+void AsyncSatNet::setState(SatID id, STATE state, function<void(bool)> done) {
+    Command command;
+    command.op = CMD_SETSTATE;
+    command.satellite.setID(id);
+    command.satellite.setState(state);
+    command.done = move(done);
+    push(command);
+}
+
+// Name - flush()
+// Desc - enqueues a marker and waits for the writer to reach it
+void AsyncSatNet::flush() {
+    Command command;
+    command.op = CMD_FLUSH;
+    pushWithFuture(command).wait();
+}
+
+// Name - enter()
+// Desc - Counts the reader in on the published view. If the writer published the other view in
+// between, it may already have seen no readers here, so the reader moves over instead of waiting.
+int AsyncSatNet::enter() const {
+    while (true) {
+        int view = m_published.load(memory_order_seq_cst);
+        m_readers[view].fetch_add(1, memory_order_seq_cst);
+        if (m_published.load(memory_order_seq_cst) == view) {
+            return view;
+        }
+        m_readers[view].fetch_sub(1, memory_order_seq_cst);
+    }
+}
+
+// Name - leave(int view)
+// Desc - counts the reader out of a view
+void AsyncSatNet::leave(int view) const {
+    m_readers[view].fetch_sub(1, memory_order_seq_cst);
+}
+
+// Name - findSatellite(SatID id)
+// Desc - findSatellite on the last published batch
+bool AsyncSatNet::findSatellite(SatID id) const {
+    int view = enter();
+    bool found = m_views[view]->findSatellite(id);
+    leave(view);
+    return found;
+}
+
+// Name - size()
+// Desc - the number of satellites after the last published batch
+int AsyncSatNet::size() const {
+    int view = enter();
+    int count = m_views[view]->size();
+    leave(view);
+    return count;
+}
+
+// Name - read(const function<void(const SatNet&)>& reader)
+// Desc - runs reader on a consistent view, the writer doesn't change it until reader returns
+void AsyncSatNet::read(const function<void(const SatNet&)>& reader) const {
+    int view = enter();
+    reader(*m_views[view]);
+    leave(view);
+}
+
+// Name - apply(SatNet& network, const Command& command)
+// Desc - performs one command on a view and returns whether it changed it
+bool AsyncSatNet::apply(SatNet& network, const Command& command) {
+    const Sat& satellite = command.satellite;
+    switch (command.op) {
+        case CMD_INSERT: return network.insert(satellite) != nullptr;
+        case CMD_REMOVE: {
+            int before = network.size();
+            network.remove(satellite.getID());
+            return network.size() < before;
+        }
+        case CMD_SETSTATE: return network.setState(satellite.getID(), satellite.getState());
+        case CMD_FLUSH: return true;
+    }
+    return false;
+}
+
+// Name - applyBatch(int view, const vector<Command>& batch, vector<bool>& results)
+// Desc - applies a batch to a view no reader is in, the caller's network is traced while it changes
+void AsyncSatNet::applyBatch(int view, const vector<Command>& batch, vector<bool>& results) {
+    SatNet& network = *m_views[view];
+    if (&network == &m_network) {
+        m_network.recordTrace(m_trace);
+    }
+    for (size_t i = 0; i < batch.size(); i++) {
+        results[i] = apply(network, batch[i]);
+    }
+    if (&network == &m_network) {
+        m_network.recordTrace(nullptr);
+    }
+}
+
+// Name - writerLoop()
+// Desc - Drains up to MAX_BATCH commands, or up to a flush marker, sorts them by id so the descents
+// walk the tree in ascending order and applies them to the view readers aren't in. The sort is
+// stable so commands on the same id keep their order. Once that view is published and the old one
+// has no readers left, the batch is applied to the old one too and the results are delivered. When
+// the ring is empty the writer sleeps until a producer wakes it.
+void AsyncSatNet::writerLoop() {
+    vector<Command> batch;
+    vector<bool> results;
+    vector<bool> repeated;
+    batch.reserve(MAX_BATCH);
+    while (true) {
+        batch.clear();
+        Command command;
+        while (batch.size() < MAX_BATCH && pop(command)) {
+            batch.push_back(move(command));
+            if (batch.back().op == CMD_FLUSH) {
+                break;
+            }
+        }
+        if (batch.empty()) {
+            if (m_stop) {
+                return;
+            }
+            // announce the sleep before checking the ring once more so a push in between isn't missed,
+            // the timeout covers the remaining race
+            unique_lock<mutex> sleep(m_sleepLock);
+            m_sleeping = true;
+            if (m_ring[m_head & m_mask].seq.load(memory_order_acquire) != m_head + 1 && !m_stop) {
+                m_wake.wait_for(sleep, chrono::milliseconds(1));
+            }
+            m_sleeping = false;
+            continue;
+        }
+        // a flush marker stays last so everything before it is applied first
+        size_t sorted = batch.back().op == CMD_FLUSH ? batch.size() - 1 : batch.size();
+        stable_sort(batch.begin(), batch.begin() + sorted, [](const Command& a, const Command& b) {
+            return a.satellite.getID() < b.satellite.getID();
+        });
+        results.assign(batch.size(), false);
+        repeated.assign(batch.size(), false);
+        // only the writer changes m_published, the other view has had no readers since the last batch
+        int old = m_published.load(memory_order_relaxed);
+        applyBatch(1 - old, batch, results);
+        m_published.store(1 - old, memory_order_seq_cst);
+        while (m_readers[old].load(memory_order_seq_cst) != 0) {
+            this_thread::yield();
+        }
+        applyBatch(old, batch, repeated);
+        m_applied.fetch_add(sorted, memory_order_release);
+        m_batches.fetch_add(1, memory_order_release);
+        for (size_t i = 0; i < batch.size(); i++) {
+            if (batch[i].result != nullptr) {
+                batch[i].result->set_value(results[i]);
+                delete batch[i].result;
+            }
+            if (batch[i].done) {
+                batch[i].done(results[i]);
+            }
+        }
+    }
+}
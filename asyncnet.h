@@ -0,0 +1,103 @@
+// Title: asyncnet.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: An asynchronous front end for SatNet. Producer threads enqueue insert, remove and
+// setState commands into a lock-free multi-producer single-consumer ring and get a future or a
+// completion callback back. One writer thread drains the ring in batches, sorts each batch by id
+// and applies it in one ascending pass over the tree. Readers see the network as of the last
+// applied batch.
+//
+// Producers only wait when the ring is full, never on the tree itself. Readers never wait either:
+// the writer keeps a mirror copy of the network and applies every batch to whichever of the two
+// views readers aren't using, publishes it with one atomic store, waits for the readers still on
+// the old view to leave and applies the batch to that one too. A read never sees half a batch, and
+// the cost is a second copy of the network. The network's trace only records the writer's
+// commands, reads aren't traced since concurrent readers would race on the TraceWriter. Callbacks
+// run on the writer thread after the batch is published and must not call flush().
+
+#ifndef ASYNCNET_H
+#define ASYNCNET_H
+#include "satnet.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#define DEFAULT_QUEUE_CAPACITY 4096 // commands, rounded up to a power of 2
+#define MAX_BATCH 1024              // the most commands the writer applies under one lock
+
+enum COMMAND {CMD_INSERT, CMD_REMOVE, CMD_SETSTATE, CMD_FLUSH};
+
+class AsyncSatNet{
+    public:
+    // network is owned by the caller, while the AsyncSatNet exists only its writer thread may change
+    // it and its trace is detached whenever readers may be using it
+    explicit AsyncSatNet(SatNet& network, int capacity = DEFAULT_QUEUE_CAPACITY);
+    ~AsyncSatNet();// applies every queued command, then stops the writer and gives the trace back
+    AsyncSatNet(const AsyncSatNet&) = delete;
+    AsyncSatNet& operator=(const AsyncSatNet&) = delete;
+
+    // each future is true if the command changed the network: a satellite was inserted or removed,
+    // or the state was set
+    future<bool> insert(const Sat& satellite);
+    future<bool> remove(SatID id);
+    future<bool> setState(SatID id, STATE state);
+    // the same commands with a callback instead of a future
+    void insert(const Sat& satellite, function<void(bool)> done);
+    void remove(SatID id, function<void(bool)> done);
+    void setState(SatID id, STATE state, function<void(bool)> done);
+    // waits until every command enqueued before the call is applied
+    void flush();
+
+    // reads of the last published batch
+    bool findSatellite(SatID id) const;
+    int size() const;
+    // runs reader on the published view, other readers may use it at the same time
+    void read(const function<void(const SatNet&)>& reader) const;
+    long long getBatches() const {return m_batches.load(memory_order_acquire);}
+    long long getApplied() const {return m_applied.load(memory_order_acquire);}// commands, flushes not included
+
+    private:
+    struct Command{
+        COMMAND op = CMD_FLUSH;
+        Sat satellite;              // the id, attributes and for setState the new state
+        promise<bool>* result = nullptr;
+        function<void(bool)> done;
+    };
+    // a ring slot, seq tells producers and the writer whose turn the slot is
+    struct Slot{
+        atomic<size_t> seq;
+        Command command;
+    };
+    void push(Command& command);// waits while the ring is full
+    bool pop(Command& command);// writer only, false if the ring is empty
+    future<bool> pushWithFuture(Command& command);
+    void writerLoop();
+    bool apply(SatNet& network, const Command& command);
+    void applyBatch(int view, const vector<Command>& batch, vector<bool>& results);
+    int enter() const;// registers a reader on the published view and returns it
+    void leave(int view) const;
+
+    SatNet& m_network;
+    SatNet m_mirror;                    //the other view, a copy that is never traced or logged
+    SatNet* m_views[2];                 //m_network and m_mirror
+    TraceWriter* m_trace;               //m_network's trace, attached only while the writer changes it
+    vector<Slot> m_ring;
+    size_t m_mask;
+    alignas(64) atomic<size_t> m_tail;  //the next slot a producer claims
+    alignas(64) size_t m_head;          //the next slot the writer reads
+    alignas(64) atomic<int> m_published;        //the view readers enter
+    alignas(64) mutable atomic<int> m_readers[2];//the readers in each view
+    mutex m_sleepLock;
+    condition_variable m_wake;
+    atomic<bool> m_sleeping;
+    atomic<bool> m_stop;
+    atomic<long long> m_batches;
+    atomic<long long> m_applied;
+    thread m_writer;
+};
+#endif
@@ -0,0 +1,402 @@
+// Title: avlcatalog.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: AvlCatalog, the AVL tree engine of SatNet as a class template over the key type, the
+// payload type and the key bounds, for tracked-object catalogs other than satellites.
+//
+// A node is a CatalogNode, the payload with the key, the child links, the height and the subtree size
+// added after it, so a catalog keeps its payload inline and allocates one block per object. The key
+// bounds are template arguments: inRange is constexpr, catalogs whose bounds are the whole key type
+// compile the check away, and a key type that isn't totally ordered or a reversed range is rejected by
+// the CatalogKey concept and the requires clause. Every comparison is the key type's own operator< on
+// a key known to be in range, inlined into the descent like the hand-written code it replaces.
+//
+// Sat is CatalogNode<SatID, SatPayload> and SatNet derives from the catalog over the whole SatID range,
+// so its rotations and rebalancing are the ones here. SatNet narrows the range at run time, see
+// SatNet(minID, maxID), and counts the rotations through its Hooks.
+
+#ifndef AVLCATALOG_H
+#define AVLCATALOG_H
+#include <concepts>
+#include <limits>
+#include <type_traits>
+using namespace std;
+class Tester;
+
+// a key has to be ordered, copyable with memcpy and have known limits for the full range check
+template <class Key>
+concept CatalogKey = totally_ordered<Key> && is_trivially_copyable_v<Key> && numeric_limits<Key>::is_specialized;
+
+enum CatalogRotation {ROTATE_LEFT, ROTATE_RIGHT, ROTATE_DOUBLE};
+
+// the default hooks of an AvlCatalog, nothing is counted and every call is inlined away
+struct CatalogHooks{
+    void rotated(CatalogRotation) {}
+};
+
+// A node of an AvlCatalog: the payload followed by the tree fields. The tree fields are public since
+// code built on the engine (SatNet, NodeSlab) splices nodes directly, a catalog only hands out const
+// nodes.
+template <CatalogKey Key, class Payload>
+class CatalogNode : public Payload{
+    public:
+    // the arguments after the key construct the payload
+    template <class... Args>
+    CatalogNode(Key id, Args&&... payload) : Payload(static_cast<Args&&>(payload)...), m_id(id) {
+        m_left = nullptr;
+        m_right = nullptr;
+        m_height = 0;
+        m_size = 1;
+        m_deleted = false;
+    }
+    CatalogNode() : CatalogNode(Key()) {}
+    Key getID() const {return m_id;}
+    int getHeight() const {return m_height;}
+    int getSize() const {return m_size;}
+    bool isDeleted() const {return m_deleted;}
+    CatalogNode* getLeft() const {return m_left;}
+    CatalogNode* getRight() const {return m_right;}
+    void setID(const Key id){m_id=id;}
+    void setHeight(int height){m_height=height;}
+    void setLeft(CatalogNode* left){m_left=left;}
+    void setRight(CatalogNode* right){m_right=right;}
+    Key m_id;
+    CatalogNode* m_left;    //the pointer to the left child in the BST
+    CatalogNode* m_right;   //the pointer to the right child in the BST
+    int m_height;           //the height of node in the BST
+    int m_size;             //the number of live nodes in the subtree, tombstones are not counted
+    bool m_deleted;         //true if the node is a tombstone, only SatNet's lazy remove leaves them
+};
+
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks = CatalogHooks>
+    requires (Min <= Max)
+class AvlCatalog{
+    public:
+    friend class Tester;
+    typedef CatalogNode<Key, Payload> Node;
+    static constexpr Key MIN_KEY = Min;
+    static constexpr Key MAX_KEY = Max;
+    // true if the bounds are the whole key type, inRange is then always true
+    static constexpr bool FULL_RANGE = Min == numeric_limits<Key>::lowest() && Max == numeric_limits<Key>::max();
+    static constexpr bool inRange(Key id) {
+        if constexpr (FULL_RANGE) {
+            return true;
+        }
+        else {
+            return Min <= id && id <= Max;
+        }
+    }
+    AvlCatalog() : m_root(nullptr), m_nodes(0) {}
+    AvlCatalog(const AvlCatalog& rhs) : m_root(nullptr), m_nodes(0) {*this = rhs;}
+    ~AvlCatalog() {clear();}
+    AvlCatalog& operator=(const AvlCatalog& rhs);
+    // returns the new node, nullptr if id is out of range or already in the catalog
+    const Node* insert(Key id, const Payload& payload = Payload());
+    bool remove(Key id);// false if id wasn't in the catalog
+    const Node* find(Key id) const;// the node with id, nullptr if there is none
+    bool contains(Key id) const {return find(id) != nullptr;}
+    int size() const {return size(m_root);}// O(1)
+    int rank(Key id) const;// the number of nodes with a key smaller than id, O(log n)
+    // calls visit(const Node&) on every node in ascending order of keys
+    template <class Visit> void forEach(Visit visit) const {forEach(m_root, visit);}
+    void clear();
+
+    protected:
+    Node* m_root;   //the root of the BST
+    int m_nodes;    //the number of nodes in the tree, tombstones included
+    [[no_unique_address]] Hooks m_hooks;    //told about every rotation
+    // the AVL primitives, shared with the code built on the catalog
+    static int height(const Node* node) {return node == nullptr ? -1 : node->m_height;}
+    static int size(const Node* node) {return node == nullptr ? 0 : node->m_size;}
+    void leftRotate(Node*& node);
+    void rightRotate(Node*& node);
+    void updateHeight(Node*& node);
+    int getBalance(Node* node);
+    void rebalance(Node*& node);
+
+    private:
+    Node* insert(Key id, const Payload& payload, Node*& node);
+    bool remove(Key id, Node*& node);
+    Node* splitMin(Node*& node);
+    void clear(Node*& node);
+    Node* copy(const Node* node);
+    template <class Visit> void forEach(const Node* node, Visit& visit) const;
+};
+
+// Name - operator=(const AvlCatalog& rhs)
+// Desc - replaces the catalog with a copy of rhs, the copy has the same shape
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+AvlCatalog<Key, Payload, Min, Max, Hooks>& AvlCatalog<Key, Payload, Min, Max, Hooks>::operator=(const AvlCatalog& rhs) {
+    if (this != &rhs) {
+        clear();
+        m_root = copy(rhs.m_root);
+    }
+    return *this;
+}
+
+// Name - insert(Key id, const Payload& payload)
+// Desc - inserts a node with id and a copy of payload, the range check is resolved at compile time
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+const typename AvlCatalog<Key, Payload, Min, Max, Hooks>::Node* AvlCatalog<Key, Payload, Min, Max, Hooks>::insert(Key id, const Payload& payload) {
+    if (!inRange(id)) {
+        return nullptr;
+    }
+    return insert(id, payload, m_root);
+}
+
+// Name - insert(Key id, const Payload& payload, Node*& node)
+// Desc - overloaded function to allow recursion, returns the new node or nullptr for a duplicate
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+typename AvlCatalog<Key, Payload, Min, Max, Hooks>::Node* AvlCatalog<Key, Payload, Min, Max, Hooks>::insert(Key id, const Payload& payload, Node*& node) {
+    if (node == nullptr) {
+        node = new Node(id, payload);
+        m_nodes++;
+        return node;
+    }
+    Node* inserted = nullptr;
+    if (id < node->m_id) {
+        inserted = insert(id, payload, node->m_left);
+    }
+    else if (node->m_id < id) {
+        inserted = insert(id, payload, node->m_right);
+    }
+    else {
+        return nullptr;
+    }
+    updateHeight(node);
+    rebalance(node);
+    return inserted;
+}
+
+// Name - remove(Key id)
+// Desc - removes the node with id from the catalog
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+bool AvlCatalog<Key, Payload, Min, Max, Hooks>::remove(Key id) {
+    if (!inRange(id)) {
+        return false;
+    }
+    return remove(id, m_root);
+}
+
+// Name - remove(Key id, Node*& node)
+// Desc - overloaded function to allow recursion, the successor is relinked in place of a node with two
+// children so every other node keeps its address
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+bool AvlCatalog<Key, Payload, Min, Max, Hooks>::remove(Key id, Node*& node) {
+    if (node == nullptr) {
+        return false;
+    }
+    bool removed = true;
+    if (id < node->m_id) {
+        removed = remove(id, node->m_left);
+    }
+    else if (node->m_id < id) {
+        removed = remove(id, node->m_right);
+    }
+    else {
+        Node* old = node;
+        if (node->m_left == nullptr || node->m_right == nullptr) {
+            node = node->m_left != nullptr ? node->m_left : node->m_right;
+        }
+        else {
+            Node* successor = splitMin(node->m_right);
+            successor->m_left = node->m_left;
+            successor->m_right = node->m_right;
+            node = successor;
+        }
+        delete old;
+        m_nodes--;
+    }
+    updateHeight(node);
+    rebalance(node);
+    return removed;
+}
+
+// Name - splitMin(Node*& node)
+// Desc - unlinks the smallest node of the subtree and returns it, the subtree stays balanced
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+typename AvlCatalog<Key, Payload, Min, Max, Hooks>::Node* AvlCatalog<Key, Payload, Min, Max, Hooks>::splitMin(Node*& node) {
+    if (node->m_left == nullptr) {
+        Node* smallest = node;
+        node = node->m_right;
+        smallest->m_right = nullptr;
+        return smallest;
+    }
+    Node* smallest = splitMin(node->m_left);
+    updateHeight(node);
+    rebalance(node);
+    return smallest;
+}
+
+// Name - find(Key id)
+// Desc - descends to the node with id, tombstones are not found
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+const typename AvlCatalog<Key, Payload, Min, Max, Hooks>::Node* AvlCatalog<Key, Payload, Min, Max, Hooks>::find(Key id) const {
+    if (!inRange(id)) {
+        return nullptr;
+    }
+    const Node* node = m_root;
+    while (node != nullptr) {
+        if (id < node->m_id) {
+            node = node->m_left;
+        }
+        else if (node->m_id < id) {
+            node = node->m_right;
+        }
+        else {
+            return node->m_deleted ? nullptr : node;
+        }
+    }
+    return nullptr;
+}
+
+// Name - rank(Key id)
+// Desc - adds up the left subtrees passed on the way down, id doesn't need to be in the catalog
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+int AvlCatalog<Key, Payload, Min, Max, Hooks>::rank(Key id) const {
+    int smaller = 0;
+    const Node* node = m_root;
+    while (node != nullptr) {
+        if (node->m_id < id) {
+            smaller += size(node->m_left) + (node->m_deleted ? 0 : 1);
+            node = node->m_right;
+        }
+        else {
+            node = node->m_left;
+        }
+    }
+    return smaller;
+}
+
+// Name - forEach(const Node* node, Visit& visit)
+// Desc - overloaded function to allow recursion, an in-order traversal that skips tombstones
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+template <class Visit>
+void AvlCatalog<Key, Payload, Min, Max, Hooks>::forEach(const Node* node, Visit& visit) const {
+    if (node == nullptr) {
+        return;
+    }
+    forEach(node->m_left, visit);
+    if (!node->m_deleted) {
+        visit(*node);
+    }
+    forEach(node->m_right, visit);
+}
+
+// Name - clear()
+// Desc - deallocates every node
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+void AvlCatalog<Key, Payload, Min, Max, Hooks>::clear() {
+    clear(m_root);
+    m_nodes = 0;
+}
+
+// Name - clear(Node*& node)
+// Desc - overloaded function to allow recursion
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+void AvlCatalog<Key, Payload, Min, Max, Hooks>::clear(Node*& node) {
+    if (node != nullptr) {
+        clear(node->m_left);
+        clear(node->m_right);
+        delete node;
+        node = nullptr;
+    }
+}
+
+// Name - copy(const Node* node)
+// Desc - overloaded function to allow recursion, copies the subtree with its heights and sizes
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+typename AvlCatalog<Key, Payload, Min, Max, Hooks>::Node* AvlCatalog<Key, Payload, Min, Max, Hooks>::copy(const Node* node) {
+    if (node == nullptr) {
+        return nullptr;
+    }
+    Node* newNode = new Node(*node);
+    m_nodes++;
+    newNode->m_left = copy(node->m_left);
+    newNode->m_right = copy(node->m_right);
+    return newNode;
+}
+
+// Name - rightRotate(Node*& node)
+// Desc - perform a right rotate on the node
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+void AvlCatalog<Key, Payload, Min, Max, Hooks>::rightRotate(Node*& node) {
+    m_hooks.rotated(ROTATE_RIGHT);
+    // perform the right rotate by switching pointers
+    Node* newRoot = node->m_left;
+    node->m_left = newRoot->m_right;
+    newRoot->m_right = node;
+    node = newRoot;
+
+    // update heights
+    updateHeight(node->m_right);
+    updateHeight(node);
+}
+
+// Name - leftRotate(Node*& node)
+// Desc - perform a left rotate on the node
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+void AvlCatalog<Key, Payload, Min, Max, Hooks>::leftRotate(Node*& node) {
+    m_hooks.rotated(ROTATE_LEFT);
+    // perform a left rotate by switching pointers
+    Node* newRoot = node->m_right;
+    node->m_right = newRoot->m_left;
+    newRoot->m_left = node;
+    node = newRoot;
+
+    // update heights
+    updateHeight(node->m_left);
+    updateHeight(node);
+}
+
+// Name - updateHeight(Node*& node)
+// Desc - defines the height and the subtree size based on the child nodes
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+void AvlCatalog<Key, Payload, Min, Max, Hooks>::updateHeight(Node*& node) {
+    if (node == nullptr) {
+        return;
+    }
+    int leftHeight = height(node->m_left);
+    int rightHeight = height(node->m_right);
+    node->m_height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+    node->m_size = size(node->m_left) + size(node->m_right) + (node->m_deleted ? 0 : 1);
+}
+
+// Name - getBalance(Node* node)
+// Desc - finds the balance factor of a given node
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+int AvlCatalog<Key, Payload, Min, Max, Hooks>::getBalance(Node* node) {
+    if (node == nullptr) {
+        return 0;
+    }
+    return height(node->m_left) - height(node->m_right);
+}
+
+// Name - rebalance(Node*& node)
+// Desc - rebalances the tree depending on the balance factor
+template <CatalogKey Key, class Payload, Key Min, Key Max, class Hooks> requires (Min <= Max)
+void AvlCatalog<Key, Payload, Min, Max, Hooks>::rebalance(Node*& node) {
+    int balance = getBalance(node);
+
+    // based on what balance is, perform these operations for all cases
+    if (balance > 1) {
+        if (getBalance(node->m_left) >= 0) {
+            rightRotate(node);
+        }
+        else {
+            m_hooks.rotated(ROTATE_DOUBLE);
+            leftRotate(node->m_left);
+            rightRotate(node);
+        }
+    } else if (balance < -1) {
+        if (getBalance(node->m_right) <= 0) {
+            leftRotate(node);
+        }
+        else {
+            m_hooks.rotated(ROTATE_DOUBLE);
+            rightRotate(node->m_right);
+            leftRotate(node);
+        }
+    }
+}
+#endif
@@ -0,0 +1,419 @@
+// Title: batch.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: A command line driver that applies a stream of text commands to one SatNet, for bulk
+// offline processing in shell pipelines.
+//
+// Usage:
+//   ./batch [input] [min id] [max id]
+// Commands are read from input, or from stdin when it is missing or "-", one per line:
+//   insert <id> <alt> <inclin> <state>   prints 1 if the satellite was inserted, else 0
+//   remove <id>                          prints 1 if a satellite was removed, else 0
+//   find <id>                            prints 1 if the satellite is in the network, else 0
+//   set <id> <state>                     prints 1 if the state was changed, else 0
+//   count <inclin>                       prints the number of satellites with the inclination
+//   purge                                removes every deorbited satellite, prints how many
+// An altitude is 208, 215, 340 or 350 and an inclination 48, 53, 70 or 97 (or the index 0-3 of
+// either), a state is active, deorbited or decaying (or 0-2). Blank lines and lines starting with #
+// are skipped, every other line prints exactly one line so the output lines up with the commands.
+// A line that doesn't parse prints "error" and is reported on stderr. The ids may be any 64-bit
+// value unless a range is given.
+//
+// iostream is too slow for millions of commands, so a regular file is mapped and parsed in place and
+// a pipe is read in large blocks, no line or token is ever copied. The results are formatted into a
+// large buffer that is written out when it fills.
+
+#include "satnet.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+const size_t READ_BLOCK = 1 << 20;   // bytes read from a pipe at a time
+const size_t OUTPUT_SIZE = 1 << 20;  // bytes of results buffered before a write
+
+// hands out the input line by line without copying it
+class LineReader{
+    public:
+    LineReader(int fd);
+    ~LineReader();
+    // points begin and end at the next line without its newline, false at the end of the input
+    bool next(const char*& begin, const char*& end);
+    private:
+    bool fill();// reads the next block after the unfinished line, false at the end of the input
+    int m_fd;
+    char* m_mapped;// the whole input when it is a regular file
+    size_t m_mappedSize;
+    char* m_buffer;// a window of the input otherwise
+    size_t m_capacity;
+    const char* m_pos;
+    const char* m_end;
+    bool m_eof;
+};
+
+// collects output in one large buffer
+class OutputBuffer{
+    public:
+    OutputBuffer(int fd) : m_fd(fd), m_buffer(new char[OUTPUT_SIZE]), m_used(0), m_failed(false) {}
+    ~OutputBuffer(){flush(); delete[] m_buffer;}
+    void putLine(long long value);
+    void putLine(const char* text);
+    bool flush();
+    bool failed() const {return m_failed;}
+    private:
+    void reserve(size_t size){if (m_used + size > OUTPUT_SIZE) flush();}
+    int m_fd;
+    char* m_buffer;
+    size_t m_used;
+    bool m_failed;
+};
+
+// Name - LineReader(int fd)
+// Desc - maps fd if it is a regular file, otherwise reads it through a growing block buffer
+LineReader::LineReader(int fd){
+    m_fd = fd;
+    m_mapped = nullptr;
+    m_mappedSize = 0;
+    m_buffer = nullptr;
+    m_capacity = 0;
+    m_pos = nullptr;
+    m_end = nullptr;
+    m_eof = false;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0){
+        void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED){
+            madvise(mapped, info.st_size, MADV_SEQUENTIAL);
+            m_mapped = static_cast<char*>(mapped);
+            m_mappedSize = info.st_size;
+            m_pos = m_mapped;
+            m_end = m_mapped + m_mappedSize;
+            m_eof = true;
+            return;
+        }
+    }
+    m_capacity = 2 * READ_BLOCK;
+    m_buffer = new char[m_capacity];
+    m_pos = m_buffer;
+    m_end = m_buffer;
+}
+
+// Name - ~LineReader()
+// Desc - unmaps or frees the input
+LineReader::~LineReader(){
+    if (m_mapped != nullptr){
+        munmap(m_mapped, m_mappedSize);
+    }
+    delete[] m_buffer;
+}
+
+// Name - fill()
+// Desc - moves the unfinished line to the front of the buffer and reads more after it
+bool LineReader::fill(){
+    if (m_eof){
+        return false;
+    }
+    size_t left = m_end - m_pos;
+    memmove(m_buffer, m_pos, left);
+    // a line longer than a block doubles the buffer
+    if (m_capacity - left < READ_BLOCK){
+        char* larger = new char[2 * m_capacity];
+        memcpy(larger, m_buffer, left);
+        delete[] m_buffer;
+        m_buffer = larger;
+        m_capacity *= 2;
+    }
+    ssize_t got;
+    do {
+        got = read(m_fd, m_buffer + left, m_capacity - left);
+    } while (got < 0 && errno == EINTR);
+    m_pos = m_buffer;
+    m_end = m_buffer + left + (got > 0 ? got : 0);
+    if (got <= 0){
+        m_eof = true;
+    }
+    return got > 0;
+}
+
+// Name - next(const char*& begin, const char*& end)
+// Desc - the next line, the last line may end without a newline
+bool LineReader::next(const char*& begin, const char*& end){
+    while (true){
+        const char* newline = static_cast<const char*>(memchr(m_pos, '\n', m_end - m_pos));
+        if (newline != nullptr){
+            begin = m_pos;
+            end = newline;
+            m_pos = newline + 1;
+            return true;
+        }
+        if (!fill()){
+            if (m_pos == m_end){
+                return false;
+            }
+            begin = m_pos;
+            end = m_end;
+            m_pos = m_end;
+            return true;
+        }
+    }
+}
+
+// Name - putLine(long long value)
+// Desc - appends value and a newline
+void OutputBuffer::putLine(long long value){
+    reserve(22);
+    char digits[20];
+    int count = 0;
+    unsigned long long magnitude = value < 0 ? 0ULL - value : value;
+    do {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (value < 0){
+        m_buffer[m_used++] = '-';
+    }
+    while (count > 0){
+        m_buffer[m_used++] = digits[--count];
+    }
+    m_buffer[m_used++] = '\n';
+}
+
+// Name - putLine(const char* text)
+// Desc - appends text and a newline
+void OutputBuffer::putLine(const char* text){
+    size_t size = strlen(text);
+    reserve(size + 1);
+    memcpy(m_buffer + m_used, text, size);
+    m_used += size;
+    m_buffer[m_used++] = '\n';
+}
+
+// Name - flush()
+// Desc - writes out everything buffered, false once a write failed
+bool OutputBuffer::flush(){
+    size_t written = 0;
+    while (written < m_used && !m_failed){
+        ssize_t result = write(m_fd, m_buffer + written, m_used - written);
+        if (result > 0){
+            written += result;
+        }
+        else if (!(result < 0 && errno == EINTR)){
+            m_failed = true;
+        }
+    }
+    m_used = 0;
+    return !m_failed;
+}
+
+// Name - skipSpaces(const char*& pos, const char* end)
+// Desc - moves pos past spaces, tabs and a carriage return
+void skipSpaces(const char*& pos, const char* end){
+    while (pos < end && (*pos == ' ' || *pos == '\t' || *pos == '\r')){
+        pos++;
+    }
+}
+
+// Name - nextWord(const char*& pos, const char* end, const char*& word)
+// Desc - the length of the next word, 0 at the end of the line
+size_t nextWord(const char*& pos, const char* end, const char*& word){
+    skipSpaces(pos, end);
+    word = pos;
+    while (pos < end && *pos != ' ' && *pos != '\t' && *pos != '\r'){
+        pos++;
+    }
+    return pos - word;
+}
+
+// Name - nextInt(const char*& pos, const char* end, long long& value)
+// Desc - parses the next word as a decimal integer
+bool nextInt(const char*& pos, const char* end, long long& value){
+    const char* word;
+    size_t size = nextWord(pos, end, word);
+    const char* digit = word;
+    bool negative = size > 0 && *digit == '-';
+    if (negative){
+        digit++;
+    }
+    if (digit == word + size || word + size - digit > 19){
+        return false;
+    }
+    unsigned long long magnitude = 0;
+    for (; digit < word + size; digit++){
+        if (*digit < '0' || *digit > '9'){
+            return false;
+        }
+        magnitude = magnitude * 10 + (*digit - '0');
+    }
+    if (magnitude > (unsigned long long)INT64_MAX + (negative ? 1 : 0)){
+        return false;
+    }
+    value = negative ? (long long)(0ULL - magnitude) : (long long)magnitude;
+    return true;
+}
+
+// Name - isWord(const char* word, size_t size, const char* expected)
+// Desc - compares a word of the line with a keyword
+bool isWord(const char* word, size_t size, const char* expected){
+    return strlen(expected) == size && memcmp(word, expected, size) == 0;
+}
+
+// Name - nextAlt(const char*& pos, const char* end, ALT& alt)
+// Desc - an altitude in miles or its index
+bool nextAlt(const char*& pos, const char* end, ALT& alt){
+    const long long miles[] = {208, 215, 340, 350};
+    long long value;
+    if (!nextInt(pos, end, value)){
+        return false;
+    }
+    for (int i = 0; i < 4; i++){
+        if (value == i || value == miles[i]){
+            alt = static_cast<ALT>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Name - nextInclin(const char*& pos, const char* end, INCLIN& inclin)
+// Desc - an inclination in degrees or its index
+bool nextInclin(const char*& pos, const char* end, INCLIN& inclin){
+    const long long degrees[] = {48, 53, 70, 97};
+    long long value;
+    if (!nextInt(pos, end, value)){
+        return false;
+    }
+    for (int i = 0; i < 4; i++){
+        if (value == i || value == degrees[i]){
+            inclin = static_cast<INCLIN>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Name - nextState(const char*& pos, const char* end, STATE& state)
+// Desc - a state by name or its index
+bool nextState(const char*& pos, const char* end, STATE& state){
+    const char* names[] = {"active", "deorbited", "decaying"};
+    const char* word;
+    size_t size = nextWord(pos, end, word);
+    for (int i = 0; i < 3; i++){
+        if (isWord(word, size, names[i]) || (size == 1 && *word == '0' + i)){
+            state = static_cast<STATE>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Name - atLineEnd(const char*& pos, const char* end)
+// Desc - true if nothing but spaces is left on the line
+bool atLineEnd(const char*& pos, const char* end){
+    skipSpaces(pos, end);
+    return pos == end;
+}
+
+// Name - runCommand(SatNet& network, const char* pos, const char* end, OutputBuffer& out)
+// Desc - applies one command line and prints its result, false if the line doesn't parse
+bool runCommand(SatNet& network, const char* pos, const char* end, OutputBuffer& out){
+    const char* word;
+    size_t size = nextWord(pos, end, word);
+    long long id = 0;
+    if (isWord(word, size, "find")){
+        if (!nextInt(pos, end, id) || !atLineEnd(pos, end)) return false;
+        out.putLine(network.findSatellite(id));
+    }
+    else if (isWord(word, size, "insert")){
+        ALT alt;
+        INCLIN inclin;
+        STATE state;
+        if (!nextInt(pos, end, id) || !nextAlt(pos, end, alt) || !nextInclin(pos, end, inclin) ||
+            !nextState(pos, end, state) || !atLineEnd(pos, end)) return false;
+        out.putLine(network.insert(Sat(id, alt, inclin, state)) != nullptr);
+    }
+    else if (isWord(word, size, "remove")){
+        if (!nextInt(pos, end, id) || !atLineEnd(pos, end)) return false;
+        int before = network.size();
+        network.remove(id);
+        out.putLine(network.size() < before);
+    }
+    else if (isWord(word, size, "set")){
+        STATE state;
+        if (!nextInt(pos, end, id) || !nextState(pos, end, state) || !atLineEnd(pos, end)) return false;
+        out.putLine(network.setState(id, state));
+    }
+    else if (isWord(word, size, "count")){
+        INCLIN inclin;
+        if (!nextInclin(pos, end, inclin) || !atLineEnd(pos, end)) return false;
+        out.putLine(network.countSatellites(inclin));
+    }
+    else if (isWord(word, size, "purge")){
+        if (!atLineEnd(pos, end)) return false;
+        int before = network.size();
+        network.removeDeorbited();
+        out.putLine(before - network.size());
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]){
+    int fd = 0;
+    if (argc > 1 && string(argv[1]) != "-"){
+        fd = open(argv[1], O_RDONLY);
+        if (fd < 0){
+            cerr << "Can't read " << argv[1] << endl;
+            return 1;
+        }
+    }
+    SatID minID = INT64_MIN;
+    SatID maxID = INT64_MAX;
+    if (argc > 3){
+        minID = strtoll(argv[2], nullptr, 10);
+        maxID = strtoll(argv[3], nullptr, 10);
+    }
+    if (argc == 3 || argc > 4 || minID > maxID){
+        cerr << "Usage: ./batch [input] [min id] [max id]" << endl;
+        return 1;
+    }
+
+    SatNet network(minID, maxID);
+    long long lineNumber = 0;
+    long long errors = 0;
+    {
+        LineReader input(fd);
+        OutputBuffer out(1);
+        const char* begin;
+        const char* end;
+        while (input.next(begin, end) && !out.failed()){
+            lineNumber++;
+            const char* pos = begin;
+            if (atLineEnd(pos, end) || *pos == '#'){
+                continue;
+            }
+            if (!runCommand(network, pos, end, out)){
+                out.putLine("error");
+                if (errors++ == 0){
+                    cerr << "line " << lineNumber << ": can't parse \"" << string(begin, end) << "\"" << endl;
+                }
+            }
+        }
+        if (!out.flush()){
+            cerr << "Can't write the results" << endl;
+            return 1;
+        }
+    }
+    if (fd != 0){
+        close(fd);
+    }
+    if (errors > 0){
+        cerr << errors << " of " << lineNumber << " lines couldn't be parsed" << endl;
+    }
+    return errors > 0 ? 2 : 0;
+}
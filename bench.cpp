@@ -0,0 +1,421 @@
+// Title: bench.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: Benchmark driver for the SatNet class. Every public operation is timed for
+// sequential, random and skewed key orders at growing network sizes, with a warm-up run and
+// repeated trials. Results are printed as a table and written as CSV to an output file.
+//
+// Usage: ./bench [max satellites] [trials] [output file]
+//   the network sizes start at 1000 and grow 10x up to max satellites (default 90000, the
+//   full default id space). Sizes past MAXID - MINID use a 64-bit id range.
+
+#include "satnet.h"
+#include "random.h"
+#include "taskpool.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <string>
+using namespace std;
+
+enum ORDER {SEQUENTIAL, RANDOMIZED, SKEWED};
+const int NUM_ORDERS = 3;
+const int DEFAULT_TRIALS = 5;
+const int DEFAULT_MAX = MAXID - MINID + 1;
+const int BLOCK = 256;          // skewed orders visit ids in ascending runs of this size
+const int HOT_PERCENT = 20;     // skewed lookups send 80% of the probes to this share of the ids
+const int SAMPLE_LIMIT = 200000;// per-operation samples kept per trial for the percentiles
+
+// a stream buffer that drops everything, used to time listSatellites without the terminal
+class NullBuffer : public streambuf {
+    protected:
+    int overflow(int c) {return c;}
+    streamsize xsputn(const char*, streamsize n) {return n;}
+};
+
+// the results of one operation over all trials
+struct Result {
+    string op;
+    ORDER order;
+    int n;
+    int trials;
+    double nsPerOp;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+};
+
+// Name - nowNs()
+// Desc - the current steady clock time in nanoseconds
+static inline long long nowNs(){
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Name - orderStr(ORDER order)
+// Desc - the printable name of a key order
+string orderStr(ORDER order){
+    switch (order){
+        case SEQUENTIAL: return "sequential";
+        case RANDOMIZED: return "random";
+        case SKEWED: return "skewed";
+    }
+    return "UNKNOWN";
+}
+
+// Name - makeIDs(int n, ORDER order, vector<SatID>& ids)
+// Desc - fills ids with n distinct ids in the given visiting order. Sequential is ascending,
+// random is a shuffle and skewed visits ascending runs of BLOCK ids in a shuffled block order,
+// which is what batched catalog ingests look like.
+void makeIDs(int n, ORDER order, SatID minID, SatID stride, vector<SatID>& ids){
+    ids.clear();
+    if (order == SEQUENTIAL){
+        for (int i = 0; i < n; i++){
+            ids.push_back(minID + SatID(i) * stride);
+        }
+    }
+    else if (order == RANDOMIZED){
+        Random shuffler(0, n - 1, SHUFFLE);
+        shuffler.setSeed(n);
+        vector<int> positions;
+        shuffler.getShuffle(positions);
+        for (int i = 0; i < n; i++){
+            ids.push_back(minID + SatID(positions[i]) * stride);
+        }
+    }
+    else {
+        int blocks = (n + BLOCK - 1) / BLOCK;
+        Random shuffler(0, blocks - 1, SHUFFLE);
+        shuffler.setSeed(n);
+        vector<int> blockOrder;
+        shuffler.getShuffle(blockOrder);
+        for (int b = 0; b < blocks; b++){
+            for (int i = blockOrder[b] * BLOCK; i < (blockOrder[b] + 1) * BLOCK && i < n; i++){
+                ids.push_back(minID + SatID(i) * stride);
+            }
+        }
+    }
+}
+
+// Name - makeProbes(const vector<SatID>& ids, ORDER order, vector<SatID>& probes)
+// Desc - the ids looked up by find and setState. Sequential and random probe every id in the
+// insertion order, skewed sends 80% of the probes to the first HOT_PERCENT of the ids.
+void makeProbes(const vector<SatID>& ids, ORDER order, vector<SatID>& probes){
+    probes.clear();
+    if (order != SKEWED){
+        probes = ids;
+        return;
+    }
+    int n = ids.size();
+    int hot = max(1, n * HOT_PERCENT / 100);
+    Random pick(0, 99);
+    Random hotGen(0, hot - 1);
+    Random allGen(0, n - 1);
+    for (int i = 0; i < n; i++){
+        if (pick.getRandNum() < 80){
+            probes.push_back(ids[hotGen.getRandNum()]);
+        }
+        else {
+            probes.push_back(ids[allGen.getRandNum()]);
+        }
+    }
+}
+
+// Name - percentile(vector<long long>& samples, double p)
+// Desc - the p-th percentile of the samples, the vector must be sorted
+double percentile(const vector<long long>& samples, double p){
+    if (samples.empty()){
+        return 0;
+    }
+    size_t index = static_cast<size_t>(p / 100.0 * (samples.size() - 1));
+    return samples[index];
+}
+
+// Name - summarize(...)
+// Desc - turns the per-operation samples and the total time of all trials into a result
+Result summarize(const string& op, ORDER order, int n, int trials, long long totalNs, long long ops, vector<long long>& samples){
+    sort(samples.begin(), samples.end());
+    Result result;
+    result.op = op;
+    result.order = order;
+    result.n = n;
+    result.trials = trials;
+    result.nsPerOp = ops > 0 ? double(totalNs) / ops : 0;
+    result.p50 = percentile(samples, 50);
+    result.p90 = percentile(samples, 90);
+    result.p99 = percentile(samples, 99);
+    result.max = samples.empty() ? 0 : samples.back();
+    return result;
+}
+
+// Name - benchOrder(int n, ORDER order, int trials, TaskPool& pool, vector<Result>& results)
+// Desc - runs every benchmark for one size and key order. The first trial is a warm-up and is
+// not recorded. The parallel union runs on the threads of pool.
+void benchOrder(int n, ORDER order, int trials, TaskPool& pool, vector<Result>& results){
+    // ids past the default range need the 64-bit range
+    SatID minID = MINID;
+    SatID maxID = MAXID;
+    SatID stride = 1;
+    if (n > MAXID - MINID + 1){
+        minID = 1000000000LL;
+        stride = 7;
+        maxID = minID + SatID(n) * stride;
+    }
+    vector<SatID> ids;
+    vector<SatID> probes;
+    makeIDs(n, order, minID, stride, ids);
+    makeProbes(ids, order, probes);
+
+    // only every sampleStep-th operation is timed on its own so the samples stay bounded
+    int sampleStep = max(1, n / SAMPLE_LIMIT);
+
+    const int NUM_OPS = 15;
+    const char* names[NUM_OPS] = {"insert", "remove", "find", "setState", "countSatellites",
+                                  "removeDeorbited", "operator=", "listSatellites", "remove(lazy)",
+                                  "union", "union(parallel)", "nextSatellite",
+                                  "find(cached)", "countShell", "find(compact)"};
+    long long total[NUM_OPS] = {0};
+    long long count[NUM_OPS] = {0};
+    vector<long long> samples[NUM_OPS];
+
+    NullBuffer nullBuffer;
+    volatile long long sink = 0;
+
+    for (int trial = 0; trial <= trials; trial++){
+        bool record = trial > 0;
+        SatNet network(minID, maxID);
+
+        // insert, timing one operation at a time for the samples and the whole loop for the total
+        long long start = nowNs();
+        for (int i = 0; i < n; i++){
+            Sat satellite(ids[i], static_cast<ALT>(ids[i] % 4), static_cast<INCLIN>((ids[i] / 4) % 4),
+                          (ids[i] % 4 == 0) ? DEORBITED : ACTIVE);
+            if (i % sampleStep == 0){
+                long long opStart = nowNs();
+                network.insert(satellite);
+                if (record) samples[0].push_back(nowNs() - opStart);
+            }
+            else {
+                network.insert(satellite);
+            }
+        }
+        if (record){total[0] += nowNs() - start; count[0] += n;}
+
+        // find
+        start = nowNs();
+        for (int i = 0; i < n; i++){
+            if (i % sampleStep == 0){
+                long long opStart = nowNs();
+                sink = sink + network.findSatellite(probes[i]);
+                if (record) samples[2].push_back(nowNs() - opStart);
+            }
+            else {
+                sink = sink + network.findSatellite(probes[i]);
+            }
+        }
+        if (record){total[2] += nowNs() - start; count[2] += n;}
+
+        // find again with the lookup cache in front of the tree
+        network.setLookupCache();
+        start = nowNs();
+        for (int i = 0; i < n; i++){
+            if (i % sampleStep == 0){
+                long long opStart = nowNs();
+                sink = sink + network.findSatellite(probes[i]);
+                if (record) samples[12].push_back(nowNs() - opStart);
+            }
+            else {
+                sink = sink + network.findSatellite(probes[i]);
+            }
+        }
+        if (record){total[12] += nowNs() - start; count[12] += n;}
+        network.setLookupCache(0);
+
+        // find again after the nodes are laid out in one block in van Emde Boas order
+        network.compact();
+        start = nowNs();
+        for (int i = 0; i < n; i++){
+            if (i % sampleStep == 0){
+                long long opStart = nowNs();
+                sink = sink + network.findSatellite(probes[i]);
+                if (record) samples[14].push_back(nowNs() - opStart);
+            }
+            else {
+                sink = sink + network.findSatellite(probes[i]);
+            }
+        }
+        if (record){total[14] += nowNs() - start; count[14] += n;}
+
+        // setState, flipping between the two live states so the deorbited count is unchanged
+        start = nowNs();
+        for (int i = 0; i < n; i++){
+            STATE state = (probes[i] % 4 == 0) ? DEORBITED : ((i & 1) ? ACTIVE : DECAYING);
+            if (i % sampleStep == 0){
+                long long opStart = nowNs();
+                network.setState(probes[i], state);
+                if (record) samples[3].push_back(nowNs() - opStart);
+            }
+            else {
+                network.setState(probes[i], state);
+            }
+        }
+        if (record){total[3] += nowNs() - start; count[3] += n;}
+
+        // nextSatellite, walking the whole network in ascending order
+        start = nowNs();
+        SatID id = minID - 1;
+        for (int i = 0; i < n; i++){
+            if (i % sampleStep == 0){
+                long long opStart = nowNs();
+                network.nextSatellite(id, id);
+                if (record) samples[11].push_back(nowNs() - opStart);
+            }
+            else {
+                network.nextSatellite(id, id);
+            }
+        }
+        sink = sink + id;
+        if (record){total[11] += nowNs() - start; count[11] += n;}
+
+        // countSatellites, one sample per inclination
+        for (int degree = I48; degree <= I97; degree++){
+            start = nowNs();
+            sink = sink + network.countSatellites(static_cast<INCLIN>(degree));
+            long long elapsed = nowNs() - start;
+            if (record){total[4] += elapsed; count[4]++; samples[4].push_back(elapsed);}
+        }
+
+        // countShell, one sample per orbital shell
+        for (int shell = 0; shell < NUM_SHELLS; shell++){
+            start = nowNs();
+            sink = sink + network.countShell(static_cast<ALT>(shell / 4), static_cast<INCLIN>(shell % 4));
+            long long elapsed = nowNs() - start;
+            if (record){total[13] += elapsed; count[13]++; samples[13].push_back(elapsed);}
+        }
+
+        // listSatellites with the output thrown away
+        streambuf* old = cout.rdbuf(&nullBuffer);
+        start = nowNs();
+        network.listSatellites();
+        long long elapsed = nowNs() - start;
+        cout.rdbuf(old);
+        if (record){total[7] += elapsed; count[7]++; samples[7].push_back(elapsed);}
+
+        // operator= into an empty network
+        SatNet copy(minID, maxID);
+        start = nowNs();
+        copy = network;
+        elapsed = nowNs() - start;
+        if (record){total[6] += elapsed; count[6]++; samples[6].push_back(elapsed);}
+
+        // removeDeorbited on the copy, a quarter of the network is deorbited
+        start = nowNs();
+        copy.removeDeorbited();
+        elapsed = nowNs() - start;
+        if (record){total[5] += elapsed; count[5]++; samples[5].push_back(elapsed);}
+
+        // union of the satellites at odd positions of ids into a copy of the ones at even positions,
+        // sequential and on the pool
+        SatNet evens(minID, maxID);
+        SatNet odds(minID, maxID);
+        for (int i = 0; i < n; i++){
+            if (i % 2 == 0) evens.insert(Sat(ids[i]));
+            else odds.insert(Sat(ids[i]));
+        }
+        for (int op = 9; op <= 10; op++){
+            SatNet merged(minID, maxID);
+            merged = evens;
+            start = nowNs();
+            if (op == 9) merged.unionWith(odds);
+            else merged.unionWith(odds, pool);
+            elapsed = nowNs() - start;
+            if (record){total[op] += elapsed; count[op]++; samples[op].push_back(elapsed);}
+        }
+
+        // remove every satellite in insertion order with lazy removal, compactions included
+        SatNet lazy(minID, maxID);
+        lazy = network;
+        lazy.setLazyRemove(true);
+        start = nowNs();
+        for (int i = 0; i < n; i++){
+            if (i % sampleStep == 0){
+                long long opStart = nowNs();
+                lazy.remove(ids[i]);
+                if (record) samples[8].push_back(nowNs() - opStart);
+            }
+            else {
+                lazy.remove(ids[i]);
+            }
+        }
+        if (record){total[8] += nowNs() - start; count[8] += n;}
+
+        // remove every satellite in insertion order
+        start = nowNs();
+        for (int i = 0; i < n; i++){
+            if (i % sampleStep == 0){
+                long long opStart = nowNs();
+                network.remove(ids[i]);
+                if (record) samples[1].push_back(nowNs() - opStart);
+            }
+            else {
+                network.remove(ids[i]);
+            }
+        }
+        if (record){total[1] += nowNs() - start; count[1] += n;}
+    }
+
+    for (int op = 0; op < NUM_OPS; op++){
+        results.push_back(summarize(names[op], order, n, trials, total[op], count[op], samples[op]));
+    }
+}
+
+int main(int argc, char* argv[]){
+    int maxN = DEFAULT_MAX;
+    int trials = DEFAULT_TRIALS;
+    string outFile = "bench_output.txt";
+    if (argc > 1) maxN = atoi(argv[1]);
+    if (argc > 2) trials = atoi(argv[2]);
+    if (argc > 3) outFile = argv[3];
+    if (maxN < 1000 || trials < 1){
+        cout << "Usage: ./bench [max satellites >= 1000] [trials >= 1] [output file]" << endl;
+        return 1;
+    }
+
+    // 1000, 10000, ... up to maxN, always finishing with maxN itself
+    vector<int> sizes;
+    for (long long n = 1000; n < maxN; n *= 10){
+        sizes.push_back(n);
+    }
+    sizes.push_back(maxN);
+
+    TaskPool pool;
+    cout << "union(parallel) runs on " << pool.getThreads() << " threads" << endl;
+    vector<Result> results;
+    cout << left << setw(16) << "operation" << setw(12) << "order" << right << setw(10) << "n"
+         << setw(12) << "ns/op" << setw(12) << "p50" << setw(12) << "p90" << setw(12) << "p99"
+         << setw(14) << "max" << endl;
+    for (size_t s = 0; s < sizes.size(); s++){
+        for (int order = 0; order < NUM_ORDERS; order++){
+            size_t first = results.size();
+            benchOrder(sizes[s], static_cast<ORDER>(order), trials, pool, results);
+            for (size_t i = first; i < results.size(); i++){
+                const Result& r = results[i];
+                cout << left << setw(16) << r.op << setw(12) << orderStr(r.order) << right << setw(10) << r.n
+                     << fixed << setprecision(1) << setw(12) << r.nsPerOp << setw(12) << r.p50
+                     << setw(12) << r.p90 << setw(12) << r.p99 << setw(14) << r.max << endl;
+            }
+        }
+    }
+
+    // machine readable output, latencies are in nanoseconds
+    ofstream out(outFile);
+    out << "operation,order,n,trials,ns_per_op,p50_ns,p90_ns,p99_ns,max_ns" << endl;
+    for (size_t i = 0; i < results.size(); i++){
+        const Result& r = results[i];
+        out << r.op << "," << orderStr(r.order) << "," << r.n << "," << r.trials << ","
+            << fixed << setprecision(1) << r.nsPerOp << "," << r.p50 << "," << r.p90 << ","
+            << r.p99 << "," << r.max << endl;
+    }
+    cout << "Results written to " << outFile << endl;
+    return 0;
+}
@@ -0,0 +1,522 @@
+// Title: catalog.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for catalog.h
+
+#include "catalog.h"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define CATALOG_AVX2
+#endif
+
+// the bit fields are read with unaligned 64-bit loads, which puts the lowest bit first on these CPUs
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "the catalog decoder needs a little endian CPU");
+
+const int CATALOG_MAGIC_SIZE = 8;
+const int BLOCK_HEADER = 10;        // the count, the width and the first id
+const int FOOTER_SIZE = 32;         // the number of blocks, the count, the index offset and the magic
+const int ATTR_BITS = 6;
+const size_t CATALOG_BUFFER_SIZE = 1 << 16;
+
+// Name - putU64(uint64_t value, unsigned char* out)
+// Desc - writes value as 8 little endian bytes
+static void putU64(uint64_t value, unsigned char* out){
+    for (int i = 0; i < 8; i++){
+        out[i] = (value >> (8 * i)) & 0xFF;
+    }
+}
+
+// Name - getU64(const unsigned char* in)
+// Desc - reads 8 little endian bytes
+static uint64_t getU64(const unsigned char* in){
+    uint64_t value = 0;
+    memcpy(&value, in, 8);
+    return value;
+}
+
+// Name - packedBytes(int count, int width)
+// Desc - the bytes taken by count values of width bits
+static size_t packedBytes(int count, int width){
+    return (uint64_t(count) * width + 7) / 8;
+}
+
+// Name - pack(const uint64_t* values, int count, int width, vector<unsigned char>& out)
+// Desc - appends the low width bits of every value, lowest bit first
+static void pack(const uint64_t* values, int count, int width, vector<unsigned char>& out){
+    size_t start = out.size();
+    out.resize(start + packedBytes(count, width), 0);
+    unsigned char* bytes = out.data() + start;
+    for (int i = 0; i < count; i++){
+        uint64_t bit = uint64_t(i) * width;
+        for (int done = 0; done < width;){
+            int shift = (bit + done) & 7;
+            int take = min(8 - shift, width - done);
+            bytes[(bit + done) >> 3] |= ((values[i] >> done) & ((1u << take) - 1)) << shift;
+            done += take;
+        }
+    }
+}
+
+// Name - decodeScalar(const unsigned char* in, int width, int first, int count, uint64_t id, SatID* ids)
+// Desc - Unpacks gaps first to count - 1 and adds them up into ids, id is the id before ids[first]. A gap
+// is one unaligned load shifted into place, or two when it crosses the end of the first word. The
+// encoding always has at least 16 bytes after a bit field (the next field, the index or the footer),
+// so the loads stay inside it.
+static void decodeScalar(const unsigned char* in, int width, int first, int count, uint64_t id, SatID* ids){
+    uint64_t mask = width == 64 ? ~0ULL : (1ULL << width) - 1;
+    for (int i = first; i < count; i++){
+        uint64_t bit = uint64_t(i) * width;
+        const unsigned char* word = in + (bit >> 3);
+        int shift = bit & 7;
+        uint64_t gap = getU64(word) >> shift;
+        if (shift + width > 64){
+            gap |= getU64(word + 8) << (64 - shift);
+        }
+        // unsigned so a catalog across the whole 64-bit range doesn't overflow
+        id += (gap & mask) + 1;
+        ids[i] = id;
+    }
+}
+
+#ifdef CATALOG_AVX2
+// Name - decodeAVX2(const unsigned char* in, int width, int count, uint64_t id, SatID* ids)
+// Desc - The scalar loop four gaps at a time. A gather loads the four words, a variable shift moves
+// every gap to the bottom of its lane and two shifted adds turn the lanes into a prefix sum that is
+// added to the last id of the previous four. Only for widths up to 56, where a gap never needs a
+// second word.
+__attribute__((target("avx2")))
+static void decodeAVX2(const unsigned char* in, int width, int count, uint64_t id, SatID* ids){
+    const __m256i mask = _mm256_set1_epi64x((1LL << width) - 1);
+    const __m256i seven = _mm256_set1_epi64x(7);
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i step = _mm256_set1_epi64x(4LL * width);
+    __m256i bits = _mm256_setr_epi64x(0, width, 2LL * width, 3LL * width);
+    __m256i last = _mm256_set1_epi64x(id);
+    int i = 0;
+    for (; i + 4 <= count; i += 4){
+        __m256i words = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(in), _mm256_srli_epi64(bits, 3), 1);
+        __m256i sums = _mm256_add_epi64(_mm256_and_si256(_mm256_srlv_epi64(words, _mm256_and_si256(bits, seven)), mask), one);
+        // lanes a b c d become a, a+b, a+b+c, a+b+c+d
+        sums = _mm256_add_epi64(sums, _mm256_blend_epi32(_mm256_permute4x64_epi64(sums, 0x90), zero, 0x03));
+        sums = _mm256_add_epi64(sums, _mm256_blend_epi32(_mm256_permute4x64_epi64(sums, 0x40), zero, 0x0F));
+        sums = _mm256_add_epi64(sums, last);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(ids + i), sums);
+        last = _mm256_permute4x64_epi64(sums, 0xFF);
+        bits = _mm256_add_epi64(bits, step);
+    }
+    decodeScalar(in, width, i, count, i == 0 ? id : ids[i - 1], ids);
+}
+
+// Name - hasAVX2()
+// Desc - true if the CPU running the program has AVX2, checked once
+static bool hasAVX2(){
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+}
+#endif
+
+// Name - decodeIDs(const unsigned char* in, int width, int count, SatID first, SatID* ids)
+// Desc - the ids of a block from its first id and its gaps, with the fastest path the CPU has. The
+// first gap is 0, so starting one below first makes ids[0] first.
+static void decodeIDs(const unsigned char* in, int width, int count, SatID first, SatID* ids){
+    uint64_t id = uint64_t(first) - 1;
+#ifdef CATALOG_AVX2
+    if (width <= 56 && hasAVX2()){
+        decodeAVX2(in, width, count, id, ids);
+        return;
+    }
+#endif
+    decodeScalar(in, width, 0, count, id, ids);
+}
+
+// Name - packAttrs(const Sat& satellite)
+// Desc - the altitude, inclination and state in 6 bits
+unsigned char packAttrs(const Sat& satellite){
+    return satellite.getAlt() | (satellite.getInclin() << 2) | (satellite.getState() << 4);
+}
+
+// Name - unpackAttrs(SatID id, unsigned char attrs)
+// Desc - the satellite with id and the attributes packed by packAttrs
+Sat unpackAttrs(SatID id, unsigned char attrs){
+    return Sat(id, static_cast<ALT>(attrs & 3), static_cast<INCLIN>((attrs >> 2) & 3), static_cast<STATE>((attrs >> 4) & 3));
+}
+
+// Name - CatalogWriter()
+// Desc - a writer that isn't open
+CatalogWriter::CatalogWriter(){
+    m_file = nullptr;
+    m_open = false;
+    m_failed = false;
+    m_offset = 0;
+    m_pending = 0;
+    m_count = 0;
+    m_lastID = 0;
+}
+
+// Name - ~CatalogWriter()
+// Desc - finishes and closes the file
+CatalogWriter::~CatalogWriter(){
+    close();
+}
+
+// Name - open(const string& fileName)
+// Desc - creates or truncates the file and starts the encoding
+bool CatalogWriter::open(const string& fileName){
+    close();
+    m_file = fopen(fileName.c_str(), "wb");
+    if (m_file == nullptr){
+        return false;
+    }
+    start();
+    return true;
+}
+
+// Name - open()
+// Desc - starts an encoding in memory, a file opened before is closed first
+void CatalogWriter::open(){
+    close();
+    start();
+}
+
+// Name - start()
+// Desc - starts a new encoding with the magic
+void CatalogWriter::start(){
+    m_out.assign(CATALOG_MAGIC, CATALOG_MAGIC + CATALOG_MAGIC_SIZE);
+    m_out.reserve(CATALOG_BUFFER_SIZE);
+    m_offset = 0;
+    m_pending = 0;
+    m_count = 0;
+    m_firstIDs.clear();
+    m_offsets.clear();
+    m_open = true;
+    m_failed = false;
+}
+
+// Name - add(const Sat& satellite)
+// Desc - queues the satellite for the current block and writes the block when it is full
+bool CatalogWriter::add(const Sat& satellite){
+    if (!m_open || (m_count > 0 && satellite.getID() <= m_lastID)){
+        return false;
+    }
+    m_lastID = satellite.getID();
+    m_ids[m_pending] = satellite.getID();
+    m_attrs[m_pending] = packAttrs(satellite);
+    m_pending++;
+    m_count++;
+    if (m_pending == CATALOG_BLOCK){
+        writeBlock();
+    }
+    return true;
+}
+
+// Name - writeBlock()
+// Desc - encodes the pending satellites as a block and adds it to the index
+void CatalogWriter::writeBlock(){
+    uint64_t values[CATALOG_BLOCK];
+    uint64_t widest = 0;
+    values[0] = 0;
+    for (int i = 1; i < m_pending; i++){
+        // unsigned so a gap across the whole 64-bit range doesn't overflow
+        values[i] = uint64_t(m_ids[i]) - uint64_t(m_ids[i - 1]) - 1;
+        widest |= values[i];
+    }
+    int width = widest == 0 ? 0 : 64 - __builtin_clzll(widest);
+    m_firstIDs.push_back(m_ids[0]);
+    m_offsets.push_back(m_offset + m_out.size());
+    size_t header = m_out.size();
+    m_out.resize(header + BLOCK_HEADER);
+    m_out[header] = m_pending - 1;
+    m_out[header + 1] = width;
+    putU64(m_ids[0], &m_out[header + 2]);
+    pack(values, m_pending, width, m_out);
+    for (int i = 0; i < m_pending; i++){
+        values[i] = m_attrs[i];
+    }
+    pack(values, m_pending, ATTR_BITS, m_out);
+    m_pending = 0;
+    if (m_file != nullptr && m_out.size() >= CATALOG_BUFFER_SIZE){
+        flush();
+    }
+}
+
+// Name - flush()
+// Desc - writes the buffered bytes to the file
+void CatalogWriter::flush(){
+    if (m_file != nullptr && !m_out.empty()){
+        if (fwrite(m_out.data(), 1, m_out.size(), m_file) != m_out.size()){
+            m_failed = true;
+        }
+        m_offset += m_out.size();
+        m_out.clear();
+    }
+}
+
+// Name - close()
+// Desc - writes the last block, the index and the footer and closes the file
+bool CatalogWriter::close(){
+    if (!m_open){
+        return !m_failed;
+    }
+    if (m_pending > 0){
+        writeBlock();
+    }
+    uint64_t indexOffset = m_offset + m_out.size();
+    size_t start = m_out.size();
+    m_out.resize(start + 16 * m_firstIDs.size() + FOOTER_SIZE);
+    unsigned char* out = &m_out[start];
+    for (size_t i = 0; i < m_firstIDs.size(); i++, out += 16){
+        putU64(m_firstIDs[i], out);
+        putU64(m_offsets[i], out + 8);
+    }
+    putU64(m_firstIDs.size(), out);
+    putU64(m_count, out + 8);
+    putU64(indexOffset, out + 16);
+    memcpy(out + 24, CATALOG_MAGIC, CATALOG_MAGIC_SIZE);
+    if (m_file != nullptr){
+        flush();
+        if (fclose(m_file) != 0){
+            m_failed = true;
+        }
+        m_file = nullptr;
+    }
+    m_open = false;
+    return !m_failed;
+}
+
+// Name - CatalogReader()
+// Desc - a reader without an encoding
+CatalogReader::CatalogReader(){
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_count = 0;
+    m_block = -1;
+    m_pos = 0;
+    m_blockCount = 0;
+}
+
+// Name - ~CatalogReader()
+// Desc - unmaps the file
+CatalogReader::~CatalogReader(){
+    close();
+}
+
+// Name - open(const string& fileName)
+// Desc - maps the whole file read only, the blocks are only paged in when they are decoded
+bool CatalogReader::open(const string& fileName){
+    close();
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0){
+        return false;
+    }
+    struct stat info;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0){
+        data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (data == MAP_FAILED){
+        return false;
+    }
+    m_data = static_cast<const unsigned char*>(data);
+    m_size = info.st_size;
+    m_mapped = true;
+    if (!parse()){
+        close();
+        return false;
+    }
+    return true;
+}
+
+// Name - open(const unsigned char* data, size_t size)
+// Desc - reads an encoding in memory
+bool CatalogReader::open(const unsigned char* data, size_t size){
+    close();
+    m_data = data;
+    m_size = size;
+    if (!parse()){
+        close();
+        return false;
+    }
+    return true;
+}
+
+// Name - close()
+// Desc - forgets the encoding
+void CatalogReader::close(){
+    if (m_mapped){
+        munmap(const_cast<unsigned char*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_count = 0;
+    m_firstIDs.clear();
+    m_offsets.clear();
+    m_block = -1;
+    m_pos = 0;
+    m_blockCount = 0;
+}
+
+// Name - parse()
+// Desc - Checks both magics and the footer and reads the index. Every block but the last must hold
+// CATALOG_BLOCK satellites and the last one the rest of the footer's count, so the counts add up.
+bool CatalogReader::parse(){
+    if (m_data == nullptr || m_size < CATALOG_MAGIC_SIZE + FOOTER_SIZE ||
+        memcmp(m_data, CATALOG_MAGIC, CATALOG_MAGIC_SIZE) != 0 ||
+        memcmp(m_data + m_size - CATALOG_MAGIC_SIZE, CATALOG_MAGIC, CATALOG_MAGIC_SIZE) != 0){
+        return false;
+    }
+    const unsigned char* footer = m_data + m_size - FOOTER_SIZE;
+    uint64_t blocks = getU64(footer);
+    uint64_t count = getU64(footer + 8);
+    uint64_t indexOffset = getU64(footer + 16);
+    if (indexOffset < CATALOG_MAGIC_SIZE || blocks > m_size / 16 || indexOffset + 16 * blocks + FOOTER_SIZE != m_size ||
+        count > blocks * CATALOG_BLOCK || (blocks > 0 && count <= (blocks - 1) * CATALOG_BLOCK)){
+        return false;
+    }
+    m_firstIDs.resize(blocks);
+    m_offsets.resize(blocks);
+    for (uint64_t i = 0; i < blocks; i++){
+        m_firstIDs[i] = getU64(m_data + indexOffset + 16 * i);
+        m_offsets[i] = getU64(m_data + indexOffset + 16 * i + 8);
+        uint64_t expected = i == 0 ? CATALOG_MAGIC_SIZE : m_offsets[i - 1] + BLOCK_HEADER;
+        if (m_offsets[i] < expected || m_offsets[i] + BLOCK_HEADER > indexOffset || (i > 0 && m_firstIDs[i] <= m_firstIDs[i - 1])){
+            return false;
+        }
+        uint64_t blockCount = i + 1 < blocks ? CATALOG_BLOCK : count - (blocks - 1) * CATALOG_BLOCK;
+        if (m_data[m_offsets[i]] + 1u != blockCount){
+            return false;
+        }
+    }
+    m_count = count;
+    return true;
+}
+
+// Name - readBlock(int block, SatID* ids, unsigned char* attrs)
+// Desc - Decodes the ids and the attributes of a block. A block with more than CATALOG_BLOCK satellites,
+// whose size or first id doesn't match the index or that has a state out of range is broken.
+int CatalogReader::readBlock(int block, SatID* ids, unsigned char* attrs) const {
+    if (block < 0 || block >= getBlocks()){
+        return -1;
+    }
+    const unsigned char* in = m_data + m_offsets[block];
+    uint64_t end = block + 1 < getBlocks() ? m_offsets[block + 1] : m_size - FOOTER_SIZE - 16 * getBlocks();
+    int count = in[0] + 1;
+    int width = in[1];
+    if (count > CATALOG_BLOCK || width > 64 || m_offsets[block] + BLOCK_HEADER + packedBytes(count, width) + packedBytes(count, ATTR_BITS) != end ||
+        (block + 1 < getBlocks() && count != CATALOG_BLOCK)){
+        return -1;
+    }
+    if (SatID(getU64(in + 2)) != m_firstIDs[block]){
+        return -1;
+    }
+    const unsigned char* gaps = in + BLOCK_HEADER;
+    decodeIDs(gaps, width, count, m_firstIDs[block], ids);
+    // every 3 bytes hold 4 attributes, the last group may fill up to 3 of the spare entries of attrs
+    const unsigned char* packed = gaps + packedBytes(count, width);
+    for (int i = 0; i < count; i += 4, packed += 3){
+        uint32_t group = packed[0] | (packed[1] << 8) | (packed[2] << 16);
+        attrs[i] = group & 63;
+        attrs[i + 1] = (group >> 6) & 63;
+        attrs[i + 2] = (group >> 12) & 63;
+        attrs[i + 3] = (group >> 18) & 63;
+    }
+    int badState = 0;
+    for (int i = 0; i < count; i++){
+        badState |= (attrs[i] & 0x30) == 0x30;
+    }
+    return badState ? -1 : count;
+}
+
+// Name - next(Sat& satellite)
+// Desc - decodes the next block when the current one is used up
+bool CatalogReader::next(Sat& satellite){
+    if (m_pos == m_blockCount){
+        if (m_block + 1 >= getBlocks()){
+            return false;
+        }
+        m_blockCount = readBlock(m_block + 1, m_ids, m_attrs);
+        if (m_blockCount < 0){
+            m_blockCount = 0;
+            m_pos = 0;
+            m_block = getBlocks();
+            return false;
+        }
+        m_block++;
+        m_pos = 0;
+    }
+    satellite = unpackAttrs(m_ids[m_pos], m_attrs[m_pos]);
+    m_pos++;
+    return true;
+}
+
+// Name - readAll(vector<Sat>& satellites)
+// Desc - decodes every block in order
+bool CatalogReader::readAll(vector<Sat>& satellites) const {
+    satellites.reserve(satellites.size() + m_count);
+    return m_count == 0 || readRange(m_firstIDs.front(), INT64_MAX, satellites);
+}
+
+// Name - readRange(SatID low, SatID high, vector<Sat>& satellites)
+// Desc - starts at the last block whose first id is <= low and stops at the first one past high
+bool CatalogReader::readRange(SatID low, SatID high, vector<Sat>& satellites) const {
+    if (low > high){
+        return true;
+    }
+    SatID ids[CATALOG_BLOCK];
+    unsigned char attrs[CATALOG_BLOCK];
+    int block = upper_bound(m_firstIDs.begin(), m_firstIDs.end(), low) - m_firstIDs.begin();
+    for (block = max(block - 1, 0); block < getBlocks() && m_firstIDs[block] <= high; block++){
+        int count = readBlock(block, ids, attrs);
+        if (count < 0){
+            return false;
+        }
+        for (int i = 0; i < count; i++){
+            if (ids[i] >= low && ids[i] <= high){
+                satellites.push_back(unpackAttrs(ids[i], attrs[i]));
+            }
+        }
+    }
+    return true;
+}
+
+// Name - saveCatalog(const SatNet& network, const string& fileName)
+// Desc - encodes the live satellites of network in id order
+bool saveCatalog(const SatNet& network, const string& fileName){
+    CatalogWriter writer;
+    if (!writer.open(fileName)){
+        return false;
+    }
+    vector<Sat> satellites;
+    network.getSatellites(satellites);
+    for (size_t i = 0; i < satellites.size(); i++){
+        writer.add(satellites[i]);
+    }
+    return writer.close();
+}
+
+// Name - loadCatalog(const string& fileName, SatNet& network)
+// Desc - clears network and inserts every satellite of the catalog, nothing is kept from a broken one
+bool loadCatalog(const string& fileName, SatNet& network){
+    CatalogReader reader;
+    vector<Sat> satellites;
+    if (!reader.open(fileName) || !reader.readAll(satellites)){
+        return false;
+    }
+    network.clear();
+    for (size_t i = 0; i < satellites.size(); i++){
+        network.insert(satellites[i]);
+    }
+    return true;
+}
@@ -0,0 +1,97 @@
+// Title: catalog.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: A compressed encoding of a whole catalog for snapshots, exports and replica transfers.
+//
+// The satellites are stored in ascending id order in blocks of CATALOG_BLOCK. A block holds
+//   byte 0        the number of satellites minus 1
+//   byte 1        the width w in bits of the gaps
+//   bytes 2-9     the first id, little endian
+//   gaps          for every satellite id - previous id - 1 (0 for the first one), w bits each
+//   attributes    alt | inclin << 2 | state << 4 for every satellite, 6 bits each
+// with both bit fields packed lowest bit first and padded to a whole byte. A dense catalog takes
+// about one byte per satellite against 11 for the raw id and attributes.
+//
+// The blocks are followed by an index with the first id and the offset of every block and a footer
+// (the number of blocks, the number of satellites, the offset of the index and the magic again), so
+// readRange only decodes the blocks that overlap the range. A writer streams blocks out as they fill
+// and a reader maps the file and decodes one block at a time. On x86-64 CPUs with AVX2 the bit fields
+// are unpacked four values at a time with gathers and variable shifts.
+
+#ifndef CATALOG_H
+#define CATALOG_H
+#include "satnet.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+using namespace std;
+
+#define CATALOG_BLOCK 128           // satellites per block
+#define CATALOG_MAGIC "SATCAT1\n"   // 8 bytes at the start and the end of the encoding
+
+class CatalogWriter{
+    public:
+    CatalogWriter();
+    ~CatalogWriter();// closes the file
+    bool open(const string& fileName);// streams the encoding to a new file
+    void open();// keeps the encoding in memory, see getData
+    // appends a satellite, false if its id isn't larger than the last one
+    bool add(const Sat& satellite);
+    bool close();// writes the last block, the index and the footer, false if a write failed
+    const vector<unsigned char>& getData() const {return m_out;}// the encoding of a writer opened in memory
+    long long getCount() const {return m_count;}
+    private:
+    void start();
+    void writeBlock();
+    void flush();
+    FILE* m_file;
+    bool m_open;
+    bool m_failed;
+    vector<unsigned char> m_out;    //the encoding, or the part that isn't written to the file yet
+    uint64_t m_offset;              //the bytes written to the file before m_out
+    SatID m_ids[CATALOG_BLOCK];
+    unsigned char m_attrs[CATALOG_BLOCK];
+    int m_pending;                  //satellites in m_ids waiting for the next block
+    long long m_count;
+    SatID m_lastID;
+    vector<SatID> m_firstIDs;       //the index
+    vector<uint64_t> m_offsets;
+};
+
+class CatalogReader{
+    public:
+    CatalogReader();
+    ~CatalogReader();// unmaps the file
+    bool open(const string& fileName);// maps the file, false if it isn't a catalog
+    bool open(const unsigned char* data, size_t size);// reads an encoding the caller keeps alive
+    void close();
+    long long size() const {return m_count;}
+    int getBlocks() const {return m_firstIDs.size();}
+    // decodes a block into ids and attrs with room for CATALOG_BLOCK each, the count or -1 if it is broken
+    int readBlock(int block, SatID* ids, unsigned char* attrs) const;
+    bool next(Sat& satellite);// the next satellite in id order, false at the end or on a broken block
+    bool readAll(vector<Sat>& satellites) const;// appends every satellite
+    bool readRange(SatID low, SatID high, vector<Sat>& satellites) const;// appends the ids in [low, high]
+    private:
+    bool parse();
+    const unsigned char* m_data;
+    size_t m_size;
+    bool m_mapped;
+    long long m_count;
+    vector<SatID> m_firstIDs;
+    vector<uint64_t> m_offsets;
+    int m_block;                    //the state of next: the decoded block and the position in it
+    int m_pos;
+    int m_blockCount;
+    SatID m_ids[CATALOG_BLOCK];
+    unsigned char m_attrs[CATALOG_BLOCK];
+};
+
+// the attributes of a satellite in the 6 bits of the encoding and back
+unsigned char packAttrs(const Sat& satellite);
+Sat unpackAttrs(SatID id, unsigned char attrs);
+// writes every satellite of network to fileName, false if it can't be written
+bool saveCatalog(const SatNet& network, const string& fileName);
+// replaces network with the satellites of a catalog file, false if it can't be read
+bool loadCatalog(const string& fileName, SatNet& network);
+#endif
@@ -0,0 +1,286 @@
+// Title: cdc.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for cdc.h
+
+#include "cdc.h"
+#include "catalog.h"
+#include <unistd.h>
+
+// Name - ChangeLog(int capacity)
+// Desc - creates an empty log that keeps the last capacity changes
+ChangeLog::ChangeLog(int capacity) : m_ring(capacity > 0 ? capacity : 1) {
+    m_firstSeq = 1;
+    m_nextSeq = 1;
+}
+
+// Name - append(const TraceOp& op)
+// Desc - stores op as the next change, overwriting the oldest one once the ring is full
+void ChangeLog::append(const TraceOp& op){
+    lock_guard<mutex> guard(m_lock);
+    m_ring[m_nextSeq % m_ring.size()] = op;
+    m_nextSeq++;
+    if (m_nextSeq - m_firstSeq > (long long)m_ring.size()){
+        m_firstSeq = m_nextSeq - m_ring.size();
+    }
+}
+
+// Name - invalidate()
+// Desc - uses up a sequence number without a change and drops the history, so no replica can replay
+// past it and a replica that was up to date before it sees that it is behind
+void ChangeLog::invalidate(){
+    lock_guard<mutex> guard(m_lock);
+    m_nextSeq++;
+    m_firstSeq = m_nextSeq;
+}
+
+// Name - getLastSeq()
+// Desc - the sequence number of the newest change
+long long ChangeLog::getLastSeq() const {
+    lock_guard<mutex> guard(m_lock);
+    return m_nextSeq - 1;
+}
+
+// Name - getFirstSeq()
+// Desc - the sequence number of the oldest change that is kept, getLastSeq() + 1 if none is
+long long ChangeLog::getFirstSeq() const {
+    lock_guard<mutex> guard(m_lock);
+    return m_firstSeq;
+}
+
+// Name - since(long long seq, ChangeBatch& batch, int maxChanges)
+// Desc - copies the changes seq + 1, seq + 2, ... into batch. An empty batch means the replica is up
+// to date. Returns false when seq + 1 was already dropped or seq is newer than the log.
+bool ChangeLog::since(long long seq, ChangeBatch& batch, int maxChanges) const {
+    lock_guard<mutex> guard(m_lock);
+    batch = ChangeBatch();
+    batch.firstSeq = seq + 1;
+    if (seq + 1 < m_firstSeq || seq >= m_nextSeq){
+        return false;
+    }
+    for (long long next = seq + 1; next < m_nextSeq && (long long)batch.ops.size() < maxChanges; next++){
+        batch.ops.push_back(m_ring[next % m_ring.size()]);
+    }
+    return true;
+}
+
+// Name - Replica(SatID minID, SatID maxID)
+// Desc - an empty replica that hasn't applied any change
+Replica::Replica(SatID minID, SatID maxID) : m_network(minID, maxID) {
+    m_seq = 0;
+}
+
+// Name - apply(const ChangeBatch& batch)
+// Desc - a snapshot replaces the network, a batch of changes must start right after getSeq()
+bool Replica::apply(const ChangeBatch& batch){
+    if (batch.snapshot){
+        m_network.clear();
+    }
+    else if (batch.firstSeq != m_seq + 1){
+        return false;
+    }
+    for (size_t i = 0; i < batch.ops.size(); i++){
+        applyTraceOp(m_network, batch.ops[i]);
+    }
+    if (batch.snapshot || !batch.ops.empty()){
+        m_seq = batch.lastSeq();
+    }
+    return true;
+}
+
+// Name - catchUp(const ChangeLog& log)
+// Desc - pulls and applies batches until the replica is at the log's last change
+bool Replica::catchUp(const ChangeLog& log){
+    ChangeBatch batch;
+    while (true){
+        if (!log.since(m_seq, batch)){
+            return false;
+        }
+        if (batch.ops.empty()){
+            return true;
+        }
+        apply(batch);
+    }
+}
+
+// Name - makeSnapshot(const SatNet& network, const ChangeLog& log)
+// Desc - every satellite of network as an insert, current to the log's last change
+ChangeBatch makeSnapshot(const SatNet& network, const ChangeLog& log){
+    ChangeBatch batch;
+    batch.snapshot = true;
+    batch.firstSeq = log.getLastSeq();
+    vector<Sat> satellites;
+    network.getSatellites(satellites);
+    batch.ops.resize(satellites.size());
+    for (size_t i = 0; i < satellites.size(); i++){
+        batch.ops[i].op = T_INSERT;
+        batch.ops[i].id = satellites[i].getID();
+        batch.ops[i].alt = satellites[i].getAlt();
+        batch.ops[i].inclin = satellites[i].getInclin();
+        batch.ops[i].state = satellites[i].getState();
+    }
+    return batch;
+}
+
+// Name - putVarint(uint64_t value, vector<unsigned char>& out)
+// Desc - appends value 7 bits at a time, lowest first
+static void putVarint(uint64_t value, vector<unsigned char>& out){
+    while (value >= 0x80){
+        out.push_back((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(value);
+}
+
+// Name - getVarint(const vector<unsigned char>& data, size_t& pos, uint64_t& value)
+// Desc - reads a varint written by putVarint, false if the data ends first
+static bool getVarint(const vector<unsigned char>& data, size_t& pos, uint64_t& value){
+    value = 0;
+    for (int shift = 0; pos < data.size() && shift <= 63; shift += 7){
+        unsigned char byte = data[pos++];
+        value |= uint64_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80)){
+            return true;
+        }
+    }
+    return false;
+}
+
+// Name - isCatalog(const ChangeBatch& batch)
+// Desc - true for a snapshot of inserts in ascending id order, which can be sent as a catalog
+static bool isCatalog(const ChangeBatch& batch){
+    for (size_t i = 0; i < batch.ops.size(); i++){
+        if (batch.ops[i].op != T_INSERT || (i > 0 && batch.ops[i].id <= batch.ops[i - 1].id)){
+            return false;
+        }
+    }
+    return batch.snapshot;
+}
+
+// Name - encodeBatch(const ChangeBatch& batch, vector<unsigned char>& out)
+// Desc - appends the flags, the first sequence number, the count and the records of batch. A snapshot
+// made by makeSnapshot is sent as a compressed catalog instead of the count and the records.
+void encodeBatch(const ChangeBatch& batch, vector<unsigned char>& out){
+    if (isCatalog(batch)){
+        out.push_back(BATCH_CATALOG);
+        putVarint(batch.firstSeq, out);
+        CatalogWriter writer;
+        writer.open();
+        for (size_t i = 0; i < batch.ops.size(); i++){
+            writer.add(Sat(batch.ops[i].id, batch.ops[i].alt, batch.ops[i].inclin, batch.ops[i].state));
+        }
+        writer.close();
+        out.insert(out.end(), writer.getData().begin(), writer.getData().end());
+        return;
+    }
+    out.push_back(batch.snapshot ? BATCH_SNAPSHOT : BATCH_CHANGES);
+    putVarint(batch.firstSeq, out);
+    putVarint(batch.ops.size(), out);
+    SatID lastID = 0;
+    for (size_t i = 0; i < batch.ops.size(); i++){
+        encodeTraceOp(batch.ops[i], lastID, out);
+    }
+}
+
+// Name - decodeBatch(const vector<unsigned char>& data, ChangeBatch& batch)
+// Desc - reads a batch written by encodeBatch
+bool decodeBatch(const vector<unsigned char>& data, ChangeBatch& batch){
+    batch = ChangeBatch();
+    if (data.empty() || data[0] > BATCH_CATALOG){
+        return false;
+    }
+    batch.snapshot = data[0] != BATCH_CHANGES;
+    size_t pos = 1;
+    uint64_t firstSeq = 0;
+    uint64_t count = 0;
+    if (!getVarint(data, pos, firstSeq)){
+        return false;
+    }
+    batch.firstSeq = firstSeq;
+    if (data[0] == BATCH_CATALOG){
+        CatalogReader reader;
+        Sat satellite;
+        if (!reader.open(data.data() + pos, data.size() - pos)){
+            return false;
+        }
+        batch.ops.resize(reader.size());
+        for (size_t i = 0; i < batch.ops.size(); i++){
+            if (!reader.next(satellite)){
+                return false;
+            }
+            batch.ops[i].op = T_INSERT;
+            batch.ops[i].id = satellite.getID();
+            batch.ops[i].alt = satellite.getAlt();
+            batch.ops[i].inclin = satellite.getInclin();
+            batch.ops[i].state = satellite.getState();
+        }
+        return true;
+    }
+    if (!getVarint(data, pos, count) || count > data.size()){
+        return false;
+    }
+    batch.ops.resize(count);
+    SatID lastID = 0;
+    auto getByte = [&data, &pos]{return pos < data.size() ? int(data[pos++]) : -1;};
+    for (uint64_t i = 0; i < count; i++){
+        if (!decodeTraceOp(getByte, lastID, batch.ops[i])){
+            return false;
+        }
+    }
+    return pos == data.size();
+}
+
+// Name - writeAll(int fd, const unsigned char* data, size_t size)
+// Desc - writes the whole buffer, write may take less than all of it on a pipe or socket
+static bool writeAll(int fd, const unsigned char* data, size_t size){
+    while (size > 0){
+        ssize_t written = write(fd, data, size);
+        if (written <= 0){
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+// Name - readAll(int fd, unsigned char* data, size_t size)
+// Desc - reads exactly size bytes, false at the end of the input or on an error
+static bool readAll(int fd, unsigned char* data, size_t size){
+    while (size > 0){
+        ssize_t got = read(fd, data, size);
+        if (got <= 0){
+            return false;
+        }
+        data += got;
+        size -= got;
+    }
+    return true;
+}
+
+// Name - writeBatch(int fd, const ChangeBatch& batch)
+// Desc - writes one length prefixed batch
+bool writeBatch(int fd, const ChangeBatch& batch){
+    vector<unsigned char> frame(4);
+    encodeBatch(batch, frame);
+    uint32_t size = frame.size() - 4;
+    for (int i = 0; i < 4; i++){
+        frame[i] = (size >> (8 * i)) & 0xFF;
+    }
+    return writeAll(fd, frame.data(), frame.size());
+}
+
+// Name - readBatch(int fd, ChangeBatch& batch)
+// Desc - reads one length prefixed batch
+bool readBatch(int fd, ChangeBatch& batch){
+    unsigned char prefix[4];
+    if (!readAll(fd, prefix, 4)){
+        return false;
+    }
+    uint32_t size = prefix[0] | (prefix[1] << 8) | (prefix[2] << 16) | (uint32_t(prefix[3]) << 24);
+    vector<unsigned char> data(size);
+    if (!readAll(fd, data.data(), size)){
+        return false;
+    }
+    return decodeBatch(data, batch);
+}
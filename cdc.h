@@ -0,0 +1,81 @@
+// Title: cdc.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: Change data capture for SatNet. A network recording to a ChangeLog appends every
+// change it makes (inserts, removes, state changes and each removal made by removeDeorbited) with
+// a sequence number. Read replicas pull the changes after the last one they applied in batches,
+// and fall back to a snapshot when the log doesn't reach back far enough.
+//
+// Bulk operations (clear, operator=, unionWith, difference, join, split, extractRange) log what they
+// did to each satellite as inserts, removes and state changes, a satellite that moves between
+// networks is a remove in one log and an insert in the other. An operation that would log more than
+// MAX_LOGGED_BULK changes skips a sequence number and drops the history instead, so replicas behind
+// it take a snapshot.
+//
+// A batch is sent as a 4 byte little endian length followed by a flags byte (BATCH_CHANGES,
+// BATCH_SNAPSHOT or BATCH_CATALOG), the varint first sequence number, the varint number of changes and
+// the changes as trace records, see trace.h. A snapshot of inserts in id order is sent as
+// BATCH_CATALOG, the sequence number followed by a compressed catalog (catalog.h), about a third of
+// the size of the trace records.
+
+#ifndef CDC_H
+#define CDC_H
+#include "satnet.h"
+#include "trace.h"
+#include <mutex>
+#include <vector>
+using namespace std;
+
+#define DEFAULT_LOG_CAPACITY 65536  // changes kept for replicas that fall behind
+#define MAX_CHANGE_BATCH 4096       // changes handed out by one call of ChangeLog::since
+#define MAX_LOGGED_BULK 4096        // changes a bulk operation logs before it invalidates the log instead
+
+enum BATCHFLAG {BATCH_CHANGES, BATCH_SNAPSHOT, BATCH_CATALOG};
+
+// a run of consecutive changes, or a snapshot of a whole network
+struct ChangeBatch{
+    long long firstSeq = 0;  // the sequence number of ops[0], for a snapshot the last change it includes
+    bool snapshot = false;   // ops insert every satellite and replace the replica's network
+    vector<TraceOp> ops;
+    // the sequence number a replica is at after applying the batch
+    long long lastSeq() const {return snapshot ? firstSeq : firstSeq + (long long)ops.size() - 1;}
+};
+
+class ChangeLog{
+    public:
+    explicit ChangeLog(int capacity = DEFAULT_LOG_CAPACITY);
+    void append(const TraceOp& op);// gives op the next sequence number, the oldest change may be dropped
+    void invalidate();// records a change that isn't in the log, every replica behind it needs a snapshot
+    long long getLastSeq() const;// the newest sequence number, 0 before the first change
+    long long getFirstSeq() const;// the oldest change that is still kept
+    // fills batch with up to maxChanges changes after seq, false if some of them aren't kept anymore
+    bool since(long long seq, ChangeBatch& batch, int maxChanges = MAX_CHANGE_BATCH) const;
+    private:
+    mutable mutex m_lock;
+    vector<TraceOp> m_ring;// change seq is at seq % capacity
+    long long m_firstSeq;
+    long long m_nextSeq;
+};
+
+class Replica{
+    public:
+    Replica(SatID minID = MINID, SatID maxID = MAXID);// the range should match the primary's
+    // applies a snapshot or the batch that follows getSeq(), false and nothing applied for anything else
+    bool apply(const ChangeBatch& batch);
+    // applies every change of log after getSeq(), false if the replica needs a snapshot first
+    bool catchUp(const ChangeLog& log);
+    long long getSeq() const {return m_seq;}
+    const SatNet& getNetwork() const {return m_network;}
+    private:
+    SatNet m_network;
+    long long m_seq;
+};
+
+// a snapshot of network as of the last change of log, the network must not change meanwhile
+ChangeBatch makeSnapshot(const SatNet& network, const ChangeLog& log);
+void encodeBatch(const ChangeBatch& batch, vector<unsigned char>& out);
+bool decodeBatch(const vector<unsigned char>& data, ChangeBatch& batch);// false for a broken batch
+// length prefixed batches over a pipe, socket or file descriptor, false on an error or the end of input
+bool writeBatch(int fd, const ChangeBatch& batch);
+bool readBatch(int fd, ChangeBatch& batch);
+#endif
@@ -0,0 +1,163 @@
+// Title: idindex.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for idindex.h
+
+#include "idindex.h"
+
+// Name - IdIndex()
+// Desc - an index that is off until setRange is called
+IdIndex::IdIndex(){
+    m_low = 0;
+    m_universe = 0;
+    m_enabled = false;
+}
+
+// Name - setRange(int64_t low, int64_t high)
+// Desc - drops every id and the bitmap, the next insert allocates it for the new range
+void IdIndex::setRange(int64_t low, int64_t high){
+    m_levels.clear();
+    m_low = low;
+    // the difference is taken unsigned so the whole 64-bit range doesn't overflow
+    uint64_t width = uint64_t(high) - uint64_t(low);
+    m_enabled = low <= high && width < uint64_t(MAX_INDEX_UNIVERSE);
+    m_universe = m_enabled ? width + 1 : 0;
+}
+
+// Name - allocate()
+// Desc - creates the levels, each one 64 times smaller than the one below down to a single word
+void IdIndex::allocate(){
+    uint64_t bits = m_universe;
+    do {
+        uint64_t words = (bits + 63) / 64;
+        m_levels.push_back(vector<uint64_t>(words, 0));
+        bits = words;
+    } while (bits > 1);
+}
+
+// Name - clear()
+// Desc - removes every id, the bitmap is kept for the next inserts
+void IdIndex::clear(){
+    for (size_t level = 0; level < m_levels.size(); level++){
+        m_levels[level].assign(m_levels[level].size(), 0);
+    }
+}
+
+// Name - insert(int64_t id)
+// Desc - sets the id's bit and the bits of the words above it that were empty
+void IdIndex::insert(int64_t id){
+    uint64_t position = uint64_t(id) - uint64_t(m_low);
+    if (!m_enabled || id < m_low || position >= m_universe){
+        return;
+    }
+    if (m_levels.empty()){
+        allocate();
+    }
+    for (size_t level = 0; level < m_levels.size(); level++){
+        uint64_t& word = m_levels[level][position >> 6];
+        bool wasEmpty = word == 0;
+        word |= 1ULL << (position & 63);
+        if (!wasEmpty){
+            return;
+        }
+        position >>= 6;
+    }
+}
+
+// Name - remove(int64_t id)
+// Desc - clears the id's bit and the bits of the words above it that became empty
+void IdIndex::remove(int64_t id){
+    uint64_t position = uint64_t(id) - uint64_t(m_low);
+    if (m_levels.empty() || id < m_low || position >= m_universe){
+        return;
+    }
+    for (size_t level = 0; level < m_levels.size(); level++){
+        uint64_t& word = m_levels[level][position >> 6];
+        word &= ~(1ULL << (position & 63));
+        if (word != 0){
+            return;
+        }
+        position >>= 6;
+    }
+}
+
+// Name - contains(int64_t id)
+// Desc - true if the id's bit is set
+bool IdIndex::contains(int64_t id) const {
+    uint64_t position = uint64_t(id) - uint64_t(m_low);
+    if (m_levels.empty() || id < m_low || position >= m_universe){
+        return false;
+    }
+    return (m_levels[0][position >> 6] >> (position & 63)) & 1;
+}
+
+// Name - next(int64_t id, int64_t& result)
+// Desc - Goes up from id's bit until a word has a set bit at or after the current position, moving
+// one word to the right at each level, then down to the lowest id under that bit.
+bool IdIndex::next(int64_t id, int64_t& result) const {
+    if (m_levels.empty()){
+        return false;
+    }
+    uint64_t position = id < m_low ? 0 : uint64_t(id) - uint64_t(m_low);
+    if (position >= m_universe){
+        return false;
+    }
+    size_t level = 0;
+    while (true){
+        const vector<uint64_t>& words = m_levels[level];
+        uint64_t index = position >> 6;
+        if (index >= words.size()){
+            return false;
+        }
+        uint64_t word = words[index] & (~0ULL << (position & 63));
+        if (word != 0){
+            position = (index << 6) + __builtin_ctzll(word);
+            break;
+        }
+        if (level + 1 == m_levels.size()){
+            return false;
+        }
+        position = index + 1;
+        level++;
+    }
+    while (level > 0){
+        level--;
+        position = (position << 6) + __builtin_ctzll(m_levels[level][position]);
+    }
+    result = m_low + int64_t(position);
+    return true;
+}
+
+// Name - prev(int64_t id, int64_t& result)
+// Desc - the mirror image of next, moving one word to the left at each level and down to the highest id
+bool IdIndex::prev(int64_t id, int64_t& result) const {
+    if (m_levels.empty() || id < m_low){
+        return false;
+    }
+    uint64_t position = uint64_t(id) - uint64_t(m_low);
+    if (position >= m_universe){
+        position = m_universe - 1;
+    }
+    size_t level = 0;
+    while (true){
+        uint64_t index = position >> 6;
+        uint64_t bit = position & 63;
+        uint64_t mask = bit == 63 ? ~0ULL : (1ULL << (bit + 1)) - 1;
+        uint64_t word = m_levels[level][index] & mask;
+        if (word != 0){
+            position = (index << 6) + 63 - __builtin_clzll(word);
+            break;
+        }
+        if (index == 0 || level + 1 == m_levels.size()){
+            return false;
+        }
+        position = index - 1;
+        level++;
+    }
+    while (level > 0){
+        level--;
+        position = (position << 6) + 63 - __builtin_clzll(m_levels[level][position]);
+    }
+    result = m_low + int64_t(position);
+    return true;
+}
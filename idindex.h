@@ -0,0 +1,46 @@
+// Title: idindex.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: A successor index over a bounded range of ids, kept next to the SatNet tree.
+//
+// The ids are bits of a 64-ary bitmap hierarchy: level 0 has one bit per id of the range, every
+// word of level k has one bit in level k + 1 that is set while the word isn't empty. The next or
+// previous id is found by going up until a word has a set bit on the right side of the start and
+// back down with one count trailing (or leading) zeros instruction per level. The default range
+// 10000 - 99999 takes three levels and about 11 KB, so next and prev touch at most six words no
+// matter how many satellites there are, where the tree needs O(log n) dependent pointer loads.
+//
+// Ranges wider than MAX_INDEX_UNIVERSE ids aren't indexed since the bitmap grows with the range and
+// not with the number of ids, SatNet falls back to its tree for them.
+
+#ifndef IDINDEX_H
+#define IDINDEX_H
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+#define MAX_INDEX_UNIVERSE (1 << 24)  // the widest id range that is indexed, 2 MB of level 0 bits
+
+class IdIndex{
+    public:
+    IdIndex();
+    // indexes the ids low - high and empties the index, a range wider than MAX_INDEX_UNIVERSE turns it off.
+    // The bitmap is only allocated by the first insert.
+    void setRange(int64_t low, int64_t high);
+    bool isEnabled() const {return m_enabled;}
+    void insert(int64_t id);
+    void remove(int64_t id);
+    void clear();
+    bool contains(int64_t id) const;
+    // the smallest id in the index that is >= id, false if there is none
+    bool next(int64_t id, int64_t& result) const;
+    // the largest id in the index that is <= id, false if there is none
+    bool prev(int64_t id, int64_t& result) const;
+    private:
+    void allocate();
+    int64_t m_low;          //the id of bit 0
+    uint64_t m_universe;    //the number of ids in the range
+    bool m_enabled;         //false for a range that is too wide
+    vector<vector<uint64_t>> m_levels;  //level 0 has a bit per id, empty until the first insert
+};
+#endif
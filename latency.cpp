@@ -0,0 +1,202 @@
+// Title: latency.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for latency.h
+
+#include "latency.h"
+#include <sstream>
+#include <iomanip>
+
+// the buckets of the Prometheus export end at the histogram bucket edges 2^7 ns (128 ns) up to 2^30 ns
+// (about 1 s), each le is the last whole ns below its edge so every exported count is exact
+const int EXPORT_FIRST_SHIFT = 7;
+const int EXPORT_LAST_SHIFT = 30;
+
+// Name - LatencyHistogram()
+// Desc - creates an empty histogram
+LatencyHistogram::LatencyHistogram(){
+    clear();
+}
+
+// Name - clear()
+// Desc - removes every recorded value
+void LatencyHistogram::clear(){
+    for (int i = 0; i < NUM_BUCKETS; i++){
+        m_buckets[i].store(0, memory_order_relaxed);
+    }
+    m_count.store(0, memory_order_relaxed);
+    m_sum.store(0, memory_order_relaxed);
+    m_max.store(0, memory_order_relaxed);
+}
+
+// Name - bucketOf(uint64_t ns)
+// Desc - the bucket of a value, the 4 bits after the highest set bit pick the sub-bucket
+int LatencyHistogram::bucketOf(uint64_t ns){
+    if (ns < SUB_BUCKETS){
+        return ns;
+    }
+    int msb = 63 - __builtin_clzll(ns);
+    int sub = (ns >> (msb - 4)) & (SUB_BUCKETS - 1);
+    return (msb - 3) * SUB_BUCKETS + sub;
+}
+
+// Name - bucketLow(int bucket)
+// Desc - the smallest value that falls into a bucket
+uint64_t LatencyHistogram::bucketLow(int bucket){
+    if (bucket < SUB_BUCKETS){
+        return bucket;
+    }
+    int msb = bucket / SUB_BUCKETS + 3;
+    return uint64_t(SUB_BUCKETS + bucket % SUB_BUCKETS) << (msb - 4);
+}
+
+// Name - bucketHigh(int bucket)
+// Desc - the smallest value past a bucket
+uint64_t LatencyHistogram::bucketHigh(int bucket){
+    if (bucket < SUB_BUCKETS){
+        return bucket + 1;
+    }
+    int msb = bucket / SUB_BUCKETS + 3;
+    return uint64_t(SUB_BUCKETS + bucket % SUB_BUCKETS + 1) << (msb - 4);
+}
+
+// Name - record(uint64_t ns)
+// Desc - adds a value to the histogram
+void LatencyHistogram::record(uint64_t ns){
+    m_buckets[bucketOf(ns)].fetch_add(1, memory_order_relaxed);
+    m_count.fetch_add(1, memory_order_relaxed);
+    m_sum.fetch_add(ns, memory_order_relaxed);
+    uint64_t current = m_max.load(memory_order_relaxed);
+    while (ns > current && !m_max.compare_exchange_weak(current, ns, memory_order_relaxed)){
+    }
+}
+
+// Name - getMean()
+// Desc - the average of the recorded values, 0 if there are none
+double LatencyHistogram::getMean() const {
+    uint64_t count = getCount();
+    if (count == 0){
+        return 0;
+    }
+    return double(getSum()) / count;
+}
+
+// Name - percentile(double p)
+// Desc - walks the buckets until p percent of the values are covered and returns the upper
+// bound of that bucket, capped by the largest recorded value
+uint64_t LatencyHistogram::percentile(double p) const {
+    uint64_t count = getCount();
+    if (count == 0){
+        return 0;
+    }
+    // the rank of the value we are looking for, at least the first one
+    uint64_t rank = static_cast<uint64_t>(p / 100.0 * count + 0.5);
+    if (rank < 1){
+        rank = 1;
+    }
+    uint64_t seen = 0;
+    for (int i = 0; i < NUM_BUCKETS; i++){
+        seen += m_buckets[i].load(memory_order_relaxed);
+        if (seen >= rank){
+            return min(bucketHigh(i) - 1, getMax());
+        }
+    }
+    return getMax();
+}
+
+// Name - countAtMost(uint64_t ns)
+// Desc - the number of values in the buckets that end at or below ns, every value from the largest
+// one up
+uint64_t LatencyHistogram::countAtMost(uint64_t ns) const {
+    if (ns >= getMax()){
+        return getCount();
+    }
+    uint64_t total = 0;
+    for (int i = 0; i < NUM_BUCKETS && bucketHigh(i) - 1 <= ns; i++){
+        total += m_buckets[i].load(memory_order_relaxed);
+    }
+    return total;
+}
+
+// Name - LatencyRecorder()
+// Desc - creates a recorder that is turned off
+LatencyRecorder::LatencyRecorder(){
+    m_sampleRate = 0;
+    for (int i = 0; i < NUM_SATOPS; i++){
+        m_calls[i].store(0, memory_order_relaxed);
+    }
+}
+
+// Name - setSampleRate(int sampleRate)
+// Desc - 0 turns the recording off, otherwise every sampleRate-th call is timed
+void LatencyRecorder::setSampleRate(int sampleRate){
+    if (sampleRate < 0){
+        sampleRate = 0;
+    }
+    m_sampleRate = sampleRate;
+}
+
+// Name - clear()
+// Desc - empties every histogram
+void LatencyRecorder::clear(){
+    for (int i = 0; i < NUM_SATOPS; i++){
+        m_histograms[i].clear();
+        m_calls[i].store(0, memory_order_relaxed);
+    }
+}
+
+// Name - opStr(SATOP op)
+// Desc - the name of an operation as it appears in the exports
+string LatencyRecorder::opStr(SATOP op){
+    string text = "";
+    switch (op){
+        case OP_INSERT:text = "insert";break;
+        case OP_REMOVE:text = "remove";break;
+        case OP_FIND:text = "findSatellite";break;
+        case OP_SETSTATE:text = "setState";break;
+        case OP_REMOVEDEORBITED:text = "removeDeorbited";break;
+        case OP_COUNT:text = "countSatellites";break;
+        case OP_ASSIGN:text = "operator=";break;
+        case OP_CLEAR:text = "clear";break;
+        default:text = "UNKNOWN";break;
+    }
+    return text;
+}
+
+// Name - toText()
+// Desc - one line per operation with the sample count, mean and tail latencies in ns
+string LatencyRecorder::toText() const {
+    ostringstream out;
+    out << left << setw(16) << "operation" << right << setw(10) << "count" << setw(12) << "mean"
+        << setw(12) << "p50" << setw(12) << "p90" << setw(12) << "p99" << setw(12) << "p999"
+        << setw(14) << "max" << "\n";
+    for (int i = 0; i < NUM_SATOPS; i++){
+        const LatencyHistogram& h = m_histograms[i];
+        out << left << setw(16) << opStr(static_cast<SATOP>(i)) << right << setw(10) << h.getCount()
+            << fixed << setprecision(1) << setw(12) << h.getMean() << setw(12) << h.percentile(50)
+            << setw(12) << h.percentile(90) << setw(12) << h.percentile(99) << setw(12) << h.percentile(99.9)
+            << setw(14) << h.getMax() << "\n";
+    }
+    return out.str();
+}
+
+// Name - toPrometheus(const string& name)
+// Desc - cumulative buckets, sum and count of every operation, labelled by op
+string LatencyRecorder::toPrometheus(const string& name) const {
+    ostringstream out;
+    out << "# HELP " << name << " Latency of the SatNet operations.\n";
+    out << "# TYPE " << name << " histogram\n";
+    for (int i = 0; i < NUM_SATOPS; i++){
+        const LatencyHistogram& h = m_histograms[i];
+        string label = "op=\"" + opStr(static_cast<SATOP>(i)) + "\"";
+        for (int shift = EXPORT_FIRST_SHIFT; shift <= EXPORT_LAST_SHIFT; shift++){
+            uint64_t bound = (uint64_t(1) << shift) - 1;
+            out << name << "_bucket{" << label << ",le=\"" << setprecision(10) << bound / 1e9 << "\"} "
+                << h.countAtMost(bound) << "\n";
+        }
+        out << name << "_bucket{" << label << ",le=\"+Inf\"} " << h.getCount() << "\n";
+        out << name << "_sum{" << label << "} " << setprecision(6) << h.getSum() / 1e9 << "\n";
+        out << name << "_count{" << label << "} " << h.getCount() << "\n";
+    }
+    return out.str();
+}
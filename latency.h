@@ -0,0 +1,99 @@
+// Title: latency.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: Log-bucketed latency histograms for the public SatNet operations
+
+#ifndef LATENCY_H
+#define LATENCY_H
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+using namespace std;
+
+// the operations that get their own histogram
+enum SATOP {OP_INSERT, OP_REMOVE, OP_FIND, OP_SETSTATE, OP_REMOVEDEORBITED, OP_COUNT, OP_ASSIGN, OP_CLEAR};
+const int NUM_SATOPS = 8;
+// values below 16ns get a bucket each, larger values get 16 linear sub-buckets per power of 2,
+// so a bucket is never wider than 1/16 (6.25%) of the values it holds
+const int SUB_BUCKETS = 16;
+const int NUM_BUCKETS = (64 - 3) * SUB_BUCKETS;
+
+class LatencyHistogram{
+    public:
+    LatencyHistogram();
+    void record(uint64_t ns);
+    void clear();
+    uint64_t getCount() const {return m_count.load(memory_order_relaxed);}
+    uint64_t getSum() const {return m_sum.load(memory_order_relaxed);}
+    uint64_t getMax() const {return m_max.load(memory_order_relaxed);}
+    double getMean() const;
+    // the upper bound in ns of the bucket holding the p-th percentile, p in [0, 100]
+    uint64_t percentile(double p) const;
+    // the number of recorded values that are at most ns, exact when ns + 1 is a bucket edge and from
+    // the largest value up, otherwise the values of the bucket holding ns are left out
+    uint64_t countAtMost(uint64_t ns) const;
+
+    static int bucketOf(uint64_t ns);
+    static uint64_t bucketLow(int bucket);
+    static uint64_t bucketHigh(int bucket);// exclusive
+
+    private:
+    // relaxed atomics since const operations such as findSatellite may record from reader threads
+    atomic<uint64_t> m_buckets[NUM_BUCKETS];
+    atomic<uint64_t> m_count;
+    atomic<uint64_t> m_sum;
+    atomic<uint64_t> m_max;
+};
+
+// one histogram per operation, recording 1 of every m_sampleRate calls of each operation
+class LatencyRecorder{
+    public:
+    LatencyRecorder();
+    // 0 turns the recording off, 1 records every call, n records every n-th call
+    void setSampleRate(int sampleRate);
+    int getSampleRate() const {return m_sampleRate;}
+    // returns true if the current call of op should be timed
+    bool sample(SATOP op){
+        if (m_sampleRate == 0){
+            return false;
+        }
+        return m_calls[op].fetch_add(1, memory_order_relaxed) % m_sampleRate == 0;
+    }
+    void record(SATOP op, uint64_t ns){m_histograms[op].record(ns);}
+    const LatencyHistogram& histogram(SATOP op) const {return m_histograms[op];}
+    void clear();
+    // count, mean and tail percentiles of every operation in a human readable table
+    string toText() const;
+    // every operation as a Prometheus histogram in the text exposition format, in seconds
+    string toPrometheus(const string& name = "satnet_operation_latency_seconds") const;
+    static string opStr(SATOP op);
+
+    private:
+    int m_sampleRate;
+    atomic<uint64_t> m_calls[NUM_SATOPS];
+    LatencyHistogram m_histograms[NUM_SATOPS];
+};
+
+// times the scope it lives in when the recorder samples the call, a steady clock read is only
+// made for sampled calls so an off or missing (nullptr) recorder costs one branch
+class LatencyTimer{
+    public:
+    LatencyTimer(LatencyRecorder* recorder, SATOP op) : m_recorder(recorder), m_op(op) {
+        m_sampled = recorder != nullptr && recorder->sample(op);
+        if (m_sampled){
+            m_start = chrono::steady_clock::now();
+        }
+    }
+    ~LatencyTimer(){
+        if (m_sampled){
+            m_recorder->record(m_op, chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - m_start).count());
+        }
+    }
+    private:
+    LatencyRecorder* m_recorder;
+    SATOP m_op;
+    bool m_sampled;
+    chrono::steady_clock::time_point m_start;
+};
+#endif
@@ -0,0 +1,192 @@
+// Title: loadgen.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: A load generator for the catalog server (server.cpp).
+//
+// Usage:
+//   ./loadgen unix <path> [levels] [requests] [depth] [mix] [keys]
+//   ./loadgen tcp <host> <port> [levels] [requests] [depth] [mix] [keys]
+// levels is a list of concurrency levels (default 1,4,16,64). At each level that many clients
+// connect at once, each on its own thread, and send requests operations of the workload mix
+// (default 2000 each, mix as in replay, default 50,30,10,9,1). A client sends depth requests at a
+// time without waiting (default 16) and then reads their responses. keys must match the server's.
+// For each level the throughput and the latency percentiles of the requests are printed, the
+// latency of a request is the time from sending its window to reading its response.
+
+#include "protocol.h"
+#include "latency.h"
+#include "workload.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+using namespace std;
+
+const int DEFAULT_REQUESTS = 2000;
+const int DEFAULT_DEPTH = 16;
+const int DEFAULT_KEYS = 50000;
+const char* DEFAULT_LEVELS = "1,4,16,64";
+
+// where the server listens
+struct Address{
+    string kind;
+    string address;
+    int port = 0;
+};
+
+// what every client of a level does
+struct ClientPlan{
+    WorkloadMix mix;
+    int requests = DEFAULT_REQUESTS;
+    int depth = DEFAULT_DEPTH;
+    int keys = DEFAULT_KEYS;
+};
+
+// Name - usage()
+// Desc - prints how to call the generator and returns the exit code for bad arguments
+int usage(){
+    cout << "Usage:" << endl;
+    cout << "  ./loadgen unix <path> [levels] [requests] [depth] [mix] [keys]" << endl;
+    cout << "  ./loadgen tcp <host> <port> [levels] [requests] [depth] [mix] [keys]" << endl;
+    cout << "  levels is a list of client counts, e.g. 1,4,16,64" << endl;
+    return 1;
+}
+
+// Name - nowNs()
+// Desc - a monotonic clock in ns
+long long nowNs(){
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Name - runClient(const Address& server, const ClientPlan& plan, int seed, LatencyHistogram& latencies, bool& ok)
+// Desc - one connection sending the plan's requests in windows of plan.depth
+void runClient(const Address& server, const ClientPlan& plan, int seed, LatencyHistogram& latencies, bool& ok){
+    ok = false;
+    int fd = connectTo(server.kind, server.address, server.port);
+    if (fd < 0){
+        return;
+    }
+    Workload workload(plan.mix, plan.keys, 0.99, seed);
+    vector<unsigned char> window;
+    vector<int> sizes;
+    vector<unsigned char> buffer;
+    for (int sent = 0; sent < plan.requests; sent += plan.depth){
+        int count = min(plan.depth, plan.requests - sent);
+        window.clear();
+        sizes.clear();
+        size_t expected = 0;
+        for (int i = 0; i < count; i++){
+            size_t opcode = window.size();
+            putRequest(workload.next(), window);
+            sizes.push_back(responseSize(window[opcode]));
+            expected += sizes.back();
+        }
+        long long start = nowNs();
+        size_t written = 0;
+        while (written < window.size()){
+            ssize_t result = write(fd, window.data() + written, window.size() - written);
+            if (result <= 0){
+                close(fd);
+                return;
+            }
+            written += result;
+        }
+        // a response is done as soon as its last byte is read
+        buffer.resize(expected);
+        size_t got = 0;
+        size_t done = 0;
+        size_t doneBytes = 0;
+        while (got < expected){
+            ssize_t result = read(fd, buffer.data() + got, expected - got);
+            if (result <= 0){
+                close(fd);
+                return;
+            }
+            got += result;
+            long long now = nowNs();
+            while (done < sizes.size() && doneBytes + sizes[done] <= got){
+                doneBytes += sizes[done];
+                done++;
+                latencies.record(now - start);
+            }
+        }
+    }
+    close(fd);
+    ok = true;
+}
+
+// Name - runLevel(const Address& server, const ClientPlan& plan, int clients)
+// Desc - runs clients connections at once and prints the throughput and the latency percentiles
+bool runLevel(const Address& server, const ClientPlan& plan, int clients){
+    LatencyHistogram latencies;
+    vector<thread> threads;
+    bool* ok = new bool[clients];
+    long long start = nowNs();
+    for (int i = 0; i < clients; i++){
+        threads.push_back(thread(runClient, cref(server), cref(plan), 100 + i, ref(latencies), ref(ok[i])));
+    }
+    for (size_t i = 0; i < threads.size(); i++){
+        threads[i].join();
+    }
+    long long elapsed = nowNs() - start;
+    bool allOk = true;
+    for (int i = 0; i < clients; i++){
+        allOk = allOk && ok[i];
+    }
+    delete[] ok;
+    if (!allOk){
+        cout << "clients " << clients << ": a connection failed" << endl;
+        return false;
+    }
+    double opsPerSec = elapsed > 0 ? latencies.getCount() * 1e9 / elapsed : 0;
+    cout << fixed << setprecision(0)
+         << setw(8) << clients << setw(12) << latencies.getCount() << setw(14) << opsPerSec
+         << setprecision(1)
+         << setw(10) << latencies.percentile(50) / 1000.0 << setw(10) << latencies.percentile(99) / 1000.0
+         << setw(10) << latencies.percentile(99.9) / 1000.0 << setw(10) << latencies.getMax() / 1000.0 << endl;
+    return true;
+}
+
+int main(int argc, char* argv[]){
+    if (argc < 3 || (string(argv[1]) != "unix" && string(argv[1]) != "tcp")){
+        return usage();
+    }
+    Address server;
+    server.kind = argv[1];
+    server.address = argv[2];
+    int next = 3;
+    if (server.kind == "tcp"){
+        if (argc < 4){
+            return usage();
+        }
+        server.port = atoi(argv[3]);
+        next = 4;
+    }
+    string levels = argc > next ? argv[next] : DEFAULT_LEVELS;
+    ClientPlan plan;
+    if (argc > next + 1) plan.requests = atoi(argv[next + 1]);
+    if (argc > next + 2) plan.depth = atoi(argv[next + 2]);
+    if (argc > next + 3 && !plan.mix.parse(argv[next + 3])){
+        return usage();
+    }
+    if (argc > next + 4) plan.keys = atoi(argv[next + 4]);
+    if (plan.requests <= 0 || plan.depth <= 0 || plan.keys <= 0){
+        return usage();
+    }
+
+    cout << "mix " << plan.mix.toString() << ", " << plan.requests << " requests per client, depth "
+         << plan.depth << ", " << plan.keys << " keys" << endl;
+    cout << setw(8) << "clients" << setw(12) << "requests" << setw(14) << "ops/s"
+         << setw(10) << "p50 us" << setw(10) << "p99 us" << setw(10) << "p99.9 us" << setw(10) << "max us" << endl;
+    stringstream list(levels);
+    string level;
+    while (getline(list, level, ',')){
+        int clients = atoi(level.c_str());
+        if (clients <= 0 || !runLevel(server, plan, clients)){
+            return 1;
+        }
+    }
+    return 0;
+}
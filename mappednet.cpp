@@ -0,0 +1,458 @@
+// Title: mappednet.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for mappednet.h
+
+#include "mappednet.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// the first node starts after the header, rounded up so every node is 8 byte aligned
+static const uint64_t FIRST_NODE = (sizeof(MappedHeader) + 7) / 8 * 8;
+
+// Name - MappedSatNet()
+// Desc - a network without a file, open has to be called first
+MappedSatNet::MappedSatNet(){
+    m_fd = -1;
+    m_base = nullptr;
+    m_header = nullptr;
+    m_mode = SYNC_ON_CLOSE;
+    m_wasClean = true;
+}
+
+// Name - ~MappedSatNet()
+// Desc - syncs and closes the file
+MappedSatNet::~MappedSatNet(){
+    close();
+}
+
+// Name - open(const string& fileName, SatID minID, SatID maxID)
+// Desc - Maps the file and checks its header, or creates it with an empty tree. Nothing is read
+// besides the header, the nodes are paged in as the tree touches them.
+bool MappedSatNet::open(const string& fileName, SatID minID, SatID maxID){
+    close();
+    m_fd = ::open(fileName.c_str(), O_RDWR | O_CREAT, 0644);
+    if (m_fd < 0){
+        return false;
+    }
+    struct stat info;
+    if (fstat(m_fd, &info) != 0){
+        close();
+        return false;
+    }
+    bool created = info.st_size == 0;
+    uint64_t bytes = created ? MAPPED_INITIAL_BYTES : uint64_t(info.st_size);
+    if ((created && ftruncate(m_fd, bytes) != 0) || bytes < FIRST_NODE || !map(bytes)){
+        close();
+        return false;
+    }
+    if (created){
+        memset(m_header, 0, sizeof(MappedHeader));
+        memcpy(m_header->magic, MAPPED_MAGIC, sizeof(m_header->magic));
+        m_header->version = MAPPED_VERSION;
+        m_header->nodeBytes = sizeof(MappedNode);
+        m_header->minID = minID <= maxID ? minID : maxID;
+        m_header->maxID = minID <= maxID ? maxID : minID;
+        m_header->fileBytes = bytes;
+        m_header->used = FIRST_NODE;
+        m_header->clean = 1;
+    }
+    // a file of another format, another node layout or one that was cut short is refused. A file
+    // longer than its header says was grown by reserve and the header page never reached the disk.
+    else if (memcmp(m_header->magic, MAPPED_MAGIC, sizeof(m_header->magic)) != 0 ||
+             m_header->version != MAPPED_VERSION || m_header->nodeBytes != sizeof(MappedNode) ||
+             m_header->fileBytes > bytes || m_header->used > bytes || m_header->used < FIRST_NODE ||
+             (m_header->used - FIRST_NODE) % sizeof(MappedNode) != 0 ||
+             !validOffset(m_header->root) || !validOffset(m_header->freeList)){
+        // unmapped here so close doesn't sync into a file that isn't ours
+        munmap(m_base, bytes);
+        m_header = nullptr;
+        close();
+        return false;
+    }
+    // close always syncs the size, so a header that lags the file means a crash
+    m_wasClean = m_header->clean == 1 && m_header->fileBytes == bytes;
+    m_header->fileBytes = bytes;
+    return true;
+}
+
+// Name - validOffset(uint64_t offset)
+// Desc - Whether offset is a link the header may hold, either 0 or the start of a node below used.
+// Checked on open so a corrupted header can't send the first find outside the mapping.
+bool MappedSatNet::validOffset(uint64_t offset) const {
+    return offset == 0 || (offset >= FIRST_NODE && offset + sizeof(MappedNode) <= m_header->used &&
+                           (offset - FIRST_NODE) % sizeof(MappedNode) == 0);
+}
+
+// Name - close()
+// Desc - syncs the changes, marks the file clean and unmaps it
+void MappedSatNet::close(){
+    if (m_header != nullptr){
+        sync();
+        munmap(m_base, m_header->fileBytes);
+    }
+    if (m_fd >= 0){
+        ::close(m_fd);
+    }
+    m_fd = -1;
+    m_base = nullptr;
+    m_header = nullptr;
+}
+
+// Name - map(uint64_t bytes)
+// Desc - maps the first bytes of the file, shared so the changes go to the file
+bool MappedSatNet::map(uint64_t bytes){
+    void* base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (base == MAP_FAILED){
+        return false;
+    }
+    m_base = static_cast<char*>(base);
+    m_header = reinterpret_cast<MappedHeader*>(m_base);
+    return true;
+}
+
+// Name - reserve()
+// Desc - Makes sure the next allocNode has room, doubling the file and mapping it again if the free
+// list is empty and the file is full. Called before a change walks the tree, since moving the mapping
+// invalidates every pointer into it while the offsets stay good. The file grows before the header
+// records it, open takes the size of the file when the new size never reached the disk.
+bool MappedSatNet::reserve(){
+    if (m_header->freeList != 0 || m_header->used + sizeof(MappedNode) <= m_header->fileBytes){
+        return true;
+    }
+    uint64_t oldBytes = m_header->fileBytes;
+    uint64_t bytes = oldBytes * 2;
+    if (ftruncate(m_fd, bytes) != 0){
+        return false;
+    }
+    munmap(m_base, oldBytes);
+    if (!map(bytes)){
+        // the change is refused and the file goes back to the size in its header
+        if (ftruncate(m_fd, oldBytes) != 0 || !map(oldBytes)){
+            m_base = nullptr;
+            m_header = nullptr;
+        }
+        return false;
+    }
+    m_header->fileBytes = bytes;
+    return true;
+}
+
+// Name - allocNode(const Sat& satellite)
+// Desc - takes a node from the free list or the end of the used part, reserve must have made room
+uint64_t MappedSatNet::allocNode(const Sat& satellite){
+    uint64_t offset = m_header->freeList;
+    if (offset != 0){
+        m_header->freeList = at(offset)->left;
+    }
+    else {
+        offset = m_header->used;
+        m_header->used += sizeof(MappedNode);
+    }
+    MappedNode* node = at(offset);
+    memset(node, 0, sizeof(MappedNode));
+    node->id = satellite.getID();
+    node->alt = satellite.getAlt();
+    node->inclin = satellite.getInclin();
+    node->state = satellite.getState();
+    m_header->nodes++;
+    return offset;
+}
+
+// Name - freeNode(uint64_t offset)
+// Desc - puts the node at the head of the free list
+void MappedSatNet::freeNode(uint64_t offset){
+    at(offset)->left = m_header->freeList;
+    m_header->freeList = offset;
+    m_header->nodes--;
+}
+
+// Name - beginChange()
+// Desc - marks the file as not clean before the first write after a sync
+void MappedSatNet::beginChange(){
+    m_header->clean = 0;
+}
+
+// Name - endChange()
+// Desc - writes the change back as the sync mode asks
+void MappedSatNet::endChange(){
+    if (m_mode == SYNC_EVERY_OP){
+        sync();
+    }
+    else if (m_mode == SYNC_ASYNC){
+        msync(m_base, m_header->fileBytes, MS_ASYNC);
+    }
+}
+
+// Name - sync()
+// Desc - marks the file clean and waits until the kernel has written every dirty page
+bool MappedSatNet::sync(){
+    if (m_header == nullptr){
+        return false;
+    }
+    m_header->clean = 1;
+    return msync(m_base, m_header->fileBytes, MS_SYNC) == 0;
+}
+
+// Name - insert(const Sat& satellite)
+// Desc - Inserts the satellite if its id is in range and not in the tree yet. A duplicate leaves
+// the file untouched, so it isn't marked dirty or synced.
+bool MappedSatNet::insert(const Sat& satellite){
+    if (m_header == nullptr || satellite.getID() < m_header->minID || satellite.getID() > m_header->maxID ||
+        find(satellite.getID()) != 0 || !reserve()){
+        return false;
+    }
+    beginChange();
+    bool inserted = insert(satellite, m_header->root);
+    endChange();
+    return inserted;
+}
+
+// Name - insert(const Sat& satellite, uint64_t& node)
+// Desc - overloaded function to allow recursion, node is the link to the subtree
+bool MappedSatNet::insert(const Sat& satellite, uint64_t& node){
+    if (node == 0){
+        node = allocNode(satellite);
+        return true;
+    }
+    bool inserted = false;
+    if (satellite.getID() < at(node)->id){
+        inserted = insert(satellite, at(node)->left);
+    }
+    else if (satellite.getID() > at(node)->id){
+        inserted = insert(satellite, at(node)->right);
+    }
+    if (inserted){
+        updateHeight(node);
+        rebalance(node);
+    }
+    return inserted;
+}
+
+// Name - remove(SatID id)
+// Desc - Removes the satellite with id if there is one. A missing id leaves the file untouched,
+// so it isn't marked dirty or synced.
+void MappedSatNet::remove(SatID id){
+    if (find(id) == 0){
+        return;
+    }
+    beginChange();
+    remove(id, m_header->root);
+    endChange();
+}
+
+// Name - remove(SatID id, uint64_t& node)
+// Desc - overloaded function to allow recursion, a node with two children is replaced by its successor
+bool MappedSatNet::remove(SatID id, uint64_t& node){
+    if (node == 0){
+        return false;
+    }
+    MappedNode* current = at(node);
+    bool removed = true;
+    if (id < current->id){
+        removed = remove(id, current->left);
+    }
+    else if (id > current->id){
+        removed = remove(id, current->right);
+    }
+    else {
+        uint64_t old = node;
+        if (current->left == 0 || current->right == 0){
+            node = current->left != 0 ? current->left : current->right;
+        }
+        else {
+            uint64_t successor = splitMin(current->right);
+            at(successor)->left = current->left;
+            at(successor)->right = current->right;
+            node = successor;
+        }
+        freeNode(old);
+    }
+    if (removed && node != 0){
+        updateHeight(node);
+        rebalance(node);
+    }
+    return removed;
+}
+
+// Name - splitMin(uint64_t& node)
+// Desc - unlinks the smallest node of the subtree and returns it, rebalancing on the way back up
+uint64_t MappedSatNet::splitMin(uint64_t& node){
+    if (at(node)->left == 0){
+        uint64_t min = node;
+        node = at(node)->right;
+        return min;
+    }
+    uint64_t min = splitMin(at(node)->left);
+    updateHeight(node);
+    rebalance(node);
+    return min;
+}
+
+// Name - updateHeight(uint64_t node)
+// Desc - sets the height from the children
+void MappedSatNet::updateHeight(uint64_t node){
+    MappedNode* current = at(node);
+    int leftHeight = current->left == 0 ? -1 : at(current->left)->height;
+    int rightHeight = current->right == 0 ? -1 : at(current->right)->height;
+    current->height = 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+}
+
+// Name - getBalance(uint64_t node)
+// Desc - the height of the left subtree minus the height of the right one
+int MappedSatNet::getBalance(uint64_t node) const {
+    if (node == 0){
+        return 0;
+    }
+    const MappedNode* current = at(node);
+    int leftHeight = current->left == 0 ? -1 : at(current->left)->height;
+    int rightHeight = current->right == 0 ? -1 : at(current->right)->height;
+    return leftHeight - rightHeight;
+}
+
+// Name - rebalance(uint64_t& node)
+// Desc - the same four AVL cases as SatNet::rebalance
+void MappedSatNet::rebalance(uint64_t& node){
+    int balance = getBalance(node);
+    if (balance > 1){
+        if (getBalance(at(node)->left) < 0){
+            leftRotate(at(node)->left);
+        }
+        rightRotate(node);
+    }
+    else if (balance < -1){
+        if (getBalance(at(node)->right) > 0){
+            rightRotate(at(node)->right);
+        }
+        leftRotate(node);
+    }
+}
+
+// Name - leftRotate(uint64_t& node)
+// Desc - makes the right child the root of the subtree
+void MappedSatNet::leftRotate(uint64_t& node){
+    uint64_t newRoot = at(node)->right;
+    at(node)->right = at(newRoot)->left;
+    at(newRoot)->left = node;
+    updateHeight(node);
+    updateHeight(newRoot);
+    node = newRoot;
+}
+
+// Name - rightRotate(uint64_t& node)
+// Desc - makes the left child the root of the subtree
+void MappedSatNet::rightRotate(uint64_t& node){
+    uint64_t newRoot = at(node)->left;
+    at(node)->left = at(newRoot)->right;
+    at(newRoot)->right = node;
+    updateHeight(node);
+    updateHeight(newRoot);
+    node = newRoot;
+}
+
+// Name - find(SatID id)
+// Desc - the offset of the node with id, 0 if there is none
+uint64_t MappedSatNet::find(SatID id) const {
+    uint64_t node = m_header == nullptr ? 0 : m_header->root;
+    while (node != 0 && at(node)->id != id){
+        node = id < at(node)->id ? at(node)->left : at(node)->right;
+    }
+    return node;
+}
+
+// Name - findSatellite(SatID id)
+// Desc - true if a satellite with id is in the network
+bool MappedSatNet::findSatellite(SatID id) const {
+    return find(id) != 0;
+}
+
+// Name - setState(SatID id, STATE state)
+// Desc - changes the state of the satellite with id, false if there is none
+bool MappedSatNet::setState(SatID id, STATE state){
+    uint64_t node = find(id);
+    if (node == 0){
+        return false;
+    }
+    beginChange();
+    at(node)->state = state;
+    endChange();
+    return true;
+}
+
+// Name - countSatellites(INCLIN degree)
+// Desc - the number of satellites with the inclination, O(n)
+int MappedSatNet::countSatellites(INCLIN degree) const {
+    return m_header == nullptr ? 0 : countSatellites(m_header->root, degree);
+}
+
+// Name - countSatellites(uint64_t node, INCLIN degree)
+// Desc - overloaded function to allow recursion
+int MappedSatNet::countSatellites(uint64_t node, INCLIN degree) const {
+    if (node == 0){
+        return 0;
+    }
+    const MappedNode* current = at(node);
+    return (current->inclin == degree) + countSatellites(current->left, degree) + countSatellites(current->right, degree);
+}
+
+// Name - getSatellites(vector<Sat>& satellites)
+// Desc - appends every satellite in ascending id order
+void MappedSatNet::getSatellites(vector<Sat>& satellites) const {
+    if (m_header != nullptr){
+        getSatellites(m_header->root, satellites);
+    }
+}
+
+// Name - getSatellites(uint64_t node, vector<Sat>& satellites)
+// Desc - overloaded function to allow recursion, an in order walk
+void MappedSatNet::getSatellites(uint64_t node, vector<Sat>& satellites) const {
+    if (node == 0){
+        return;
+    }
+    const MappedNode* current = at(node);
+    getSatellites(current->left, satellites);
+    satellites.push_back(Sat(current->id, static_cast<ALT>(current->alt), static_cast<INCLIN>(current->inclin),
+                             static_cast<STATE>(current->state)));
+    getSatellites(current->right, satellites);
+}
+
+// Name - size()
+// Desc - the number of satellites, kept in the header
+int MappedSatNet::size() const {
+    return m_header == nullptr ? 0 : int(m_header->nodes);
+}
+
+// Name - clear()
+// Desc - empties the tree and the free list, the nodes are allocated from the start again
+void MappedSatNet::clear(){
+    if (m_header == nullptr){
+        return;
+    }
+    beginChange();
+    m_header->root = 0;
+    m_header->freeList = 0;
+    m_header->used = FIRST_NODE;
+    m_header->nodes = 0;
+    endChange();
+}
+
+// Name - getMinID()
+// Desc - the smallest id the file accepts
+SatID MappedSatNet::getMinID() const {
+    return m_header == nullptr ? MINID : m_header->minID;
+}
+
+// Name - getMaxID()
+// Desc - the largest id the file accepts
+SatID MappedSatNet::getMaxID() const {
+    return m_header == nullptr ? MAXID : m_header->maxID;
+}
+
+// Name - getFileBytes()
+// Desc - the size of the file, 0 while closed
+uint64_t MappedSatNet::getFileBytes() const {
+    return m_header == nullptr ? 0 : m_header->fileBytes;
+}
@@ -0,0 +1,112 @@
+// Title: mappednet.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: MappedSatNet, a SatNet kept in a memory mapped file so a catalog survives restarts
+// without a load step.
+//
+// The file starts with a MappedHeader followed by the nodes. A node links to its children by their
+// byte offset in the file (0 is null, the header is there), so the tree means the same thing wherever
+// the file is mapped and growing the file can move the mapping. Removed nodes go on a free list kept
+// in the file, a new node takes the head of the list before the file grows. Opening an existing file
+// is an open, an mmap and a header check, no matter how many satellites it holds.
+//
+// Writes go to the mapping and the kernel writes them back when it likes. The sync mode decides
+// when the program waits for them: SYNC_ON_CLOSE only in sync() and close(), SYNC_ASYNC starts the
+// write back after every change and SYNC_EVERY_OP waits for it after every change. A crash in the
+// middle of a change can leave the tree half rebalanced, wasClean() tells if the last session of the
+// file ended with a sync.
+
+#ifndef MAPPEDNET_H
+#define MAPPEDNET_H
+#include "satnet.h"
+#include <string>
+#include <vector>
+using namespace std;
+
+enum SYNCMODE {SYNC_ON_CLOSE, SYNC_ASYNC, SYNC_EVERY_OP};
+#define MAPPED_MAGIC "SATMAP1"          // 7 characters and the terminator
+#define MAPPED_VERSION 1
+#define MAPPED_INITIAL_BYTES (1 << 16)  // the size of a new file, it doubles whenever it is full
+
+// the first bytes of the file
+struct MappedHeader{
+    char magic[8];
+    uint32_t version;
+    uint32_t nodeBytes;     // sizeof(MappedNode) of the build that created the file
+    int64_t minID;
+    int64_t maxID;
+    uint64_t fileBytes;     // the size of the file
+    uint64_t used;          // the end of the last node ever allocated
+    uint64_t root;          // the offset of the root, 0 for an empty tree
+    uint64_t freeList;      // the first free node, each one links to the next through its left offset
+    int64_t nodes;          // the number of nodes in the tree
+    uint32_t clean;         // 1 if everything was synced when the file was last closed
+    uint32_t padding;
+};
+
+// a node of the tree, children are offsets from the start of the file
+struct MappedNode{
+    SatID id;
+    uint64_t left;
+    uint64_t right;
+    int32_t height;
+    uint8_t alt;
+    uint8_t inclin;
+    uint8_t state;
+    uint8_t padding;
+};
+
+class MappedSatNet{
+    public:
+    friend class Tester;
+    MappedSatNet();
+    ~MappedSatNet();// closes the file
+    // Opens the catalog in fileName, creating it with the id range minID - maxID if it doesn't exist.
+    // The range of an existing file is kept. Returns false if the file can't be mapped or its header
+    // doesn't match this build.
+    bool open(const string& fileName, SatID minID = MINID, SatID maxID = MAXID);
+    void close();// syncs and unmaps the file
+    bool isOpen() const {return m_header != nullptr;}
+    bool wasClean() const {return m_wasClean;}// false if the file wasn't synced when it was last closed
+    void setSyncMode(SYNCMODE mode){m_mode = mode;}
+    SYNCMODE getSyncMode() const {return m_mode;}
+    bool sync();// writes every change back to the file and waits for it
+    bool insert(const Sat& satellite);// false for a duplicate or an id out of range
+    void remove(SatID id);
+    bool findSatellite(SatID id) const;
+    bool setState(SatID id, STATE state);
+    int countSatellites(INCLIN degree) const;
+    void getSatellites(vector<Sat>& satellites) const;// appends every satellite in ascending id order
+    int size() const;
+    void clear();// removes every satellite, the file keeps its size
+    SatID getMinID() const;
+    SatID getMaxID() const;
+    uint64_t getFileBytes() const;
+    private:
+    int m_fd;
+    char* m_base;               //the start of the mapping
+    MappedHeader* m_header;     //the same address as m_base, nullptr while closed
+    SYNCMODE m_mode;
+    bool m_wasClean;
+
+    MappedNode* at(uint64_t offset) const {return reinterpret_cast<MappedNode*>(m_base + offset);}
+    bool map(uint64_t bytes);
+    bool validOffset(uint64_t offset) const;
+    bool reserve();
+    uint64_t allocNode(const Sat& satellite);
+    void freeNode(uint64_t offset);
+    void beginChange();
+    void endChange();
+    bool insert(const Sat& satellite, uint64_t& node);
+    bool remove(SatID id, uint64_t& node);
+    uint64_t splitMin(uint64_t& node);
+    void updateHeight(uint64_t node);
+    int getBalance(uint64_t node) const;
+    void rebalance(uint64_t& node);
+    void leftRotate(uint64_t& node);
+    void rightRotate(uint64_t& node);
+    uint64_t find(SatID id) const;
+    int countSatellites(uint64_t node, INCLIN degree) const;
+    void getSatellites(uint64_t node, vector<Sat>& satellites) const;
+};
+#endif
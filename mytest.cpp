@@ -1,1211 +1,3793 @@
-// Title: mytest.cpp
-// Author: Andrew Tang
-// Date: 9/15/2023
-// Description: This is a tester file for satnet.cpp
-
-#include "satnet.h"
-#include <math.h>
-#include <algorithm>
-#include <random>
-#include <vector>
-using namespace std; 
-
-enum RANDOM {UNIFORMINT, UNIFORMREAL, NORMAL, SHUFFLE};
-class Random {
-public:
-    Random(int min, int max, RANDOM type=UNIFORMINT, int mean=50, int stdev=20) : m_min(min), m_max(max), m_type(type)
-    {
-        if (type == NORMAL){
-            //the case of NORMAL to generate integer numbers with normal distribution
-            m_generator = std::mt19937(m_device());
-            //the data set will have the mean of 50 (default) and standard deviation of 20 (default)
-            //the mean and standard deviation can change by passing new values to constructor 
-            m_normdist = std::normal_distribution<>(mean,stdev);
-        }
-        else if (type == UNIFORMINT) {
-            //the case of UNIFORMINT to generate integer numbers
-            // Using a fixed seed value generates always the same sequence
-            // of pseudorandom numbers, e.g. reproducing scientific experiments
-            // here it helps us with testing since the same sequence repeats
-            m_generator = std::mt19937(10);// 10 is the fixed seed value
-            m_unidist = std::uniform_int_distribution<>(min,max);
-        }
-        else if (type == UNIFORMREAL) { //the case of UNIFORMREAL to generate real numbers
-            m_generator = std::mt19937(10);// 10 is the fixed seed value
-            m_uniReal = std::uniform_real_distribution<double>((double)min,(double)max);
-        }
-        else { //the case of SHUFFLE to generate every number only once
-            m_generator = std::mt19937(m_device());
-        }
-    }
-    void setSeed(int seedNum){
-        // we have set a default value for seed in constructor
-        // we can change the seed by calling this function after constructor call
-        // this gives us more randomness
-        m_generator = std::mt19937(seedNum);
-    }
-
-    void getShuffle(vector<int> & array){
-        // the user program creates the vector param and passes here
-        // here we populate the vector using m_min and m_max
-        for (int i = m_min; i<=m_max; i++){
-            array.push_back(i);
-        }
-        shuffle(array.begin(),array.end(),m_generator);
-    }
-
-    void getShuffle(int array[]){
-        // the param array must be of the size (m_max-m_min+1)
-        // the user program creates the array and pass it here
-        vector<int> temp;
-        for (int i = m_min; i<=m_max; i++){
-            temp.push_back(i);
-        }
-        std::shuffle(temp.begin(), temp.end(), m_generator);
-        vector<int>::iterator it;
-        int i = 0;
-        for (it=temp.begin(); it != temp.end(); it++){
-            array[i] = *it;
-            i++;
-        }
-    }
-
-    int getRandNum(){
-        // this function returns integer numbers
-        // the object must have been initialized to generate integers
-        int result = 0;
-        if(m_type == NORMAL){
-            //returns a random number in a set with normal distribution
-            //we limit random numbers by the min and max values
-            result = m_min - 1;
-            while(result < m_min || result > m_max)
-                result = m_normdist(m_generator);
-        }
-        else if (m_type == UNIFORMINT){
-            //this will generate a random number between min and max values
-            result = m_unidist(m_generator);
-        }
-        return result;
-    }
-
-    double getRealRandNum(){
-        // this function returns real numbers
-        // the object must have been initialized to generate real numbers
-        double result = m_uniReal(m_generator);
-        // a trick to return numbers only with two deciaml points
-        // for example if result is 15.0378, function returns 15.03
-        // to round up we can use ceil function instead of floor
-        result = std::floor(result*100.0)/100.0;
-        return result;
-    }
-    
-    private:
-    int m_min;
-    int m_max;
-    RANDOM m_type;
-    std::random_device m_device;
-    std::mt19937 m_generator;
-    std::normal_distribution<> m_normdist;//normal distribution
-    std::uniform_int_distribution<> m_unidist;//integer uniform distribution
-    std::uniform_real_distribution<double> m_uniReal;//real uniform distribution
-};
-
-class Tester{
-    public:
-
-    // ==================================================| Test Cases for the SATNET Class |============================================================
-    //Function: insert(const Sat& satellite)
-    //Case: Normal Case
-    //Expected result: resulting tree is as expected
-    bool insertNormal() {
-        cout << "TEST 1 RESULTS:" << endl; 
-
-        SatNet network;
-        // insert in nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i);
-            network.insert(satellite);
-        }
-
-        // make sure its still an avl tree
-        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
-            return false; 
-        }
-
-        // make sure that output is as expected, has the correct nodes
-        if (out(network.m_root) != "((10000:0)10001:2((10002:0)10003:1(10004:0)))"){
-            return false;  
-        }
-        return true; 
-    }
-
-    //Function: insert(const Sat& satellite)
-    //Case: Edge case where duplicates are inserted
-    //Expected result: resulting tree is as expected, duplicates are not inserted
-    bool insertEdge() {
-        cout << "TEST 2 RESULTS:" << endl; 
-
-        SatNet network;
-        // insert in nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i);
-            network.insert(satellite);
-        }
-
-        // inserts the same node
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i);
-            network.insert(satellite);
-        }
-
-        // make sure its still an avl tree
-        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
-            return false; 
-        }
-
-        // make sure that duplicates are handled by being not added, has the correct nodes
-        if (out(network.m_root) != "((10000:0)10001:2((10002:0)10003:1(10004:0)))"){
-            return false; 
-        }
-        return true; 
-    }
-
-    //Function: insert(const Sat& satellite)
-    //Case: Error Case where nodes have invalid IDs are inserted
-    //Expected result: resulting tree is as expected, nothing is inserted
-    bool insertError() {
-        cout << "TEST 3 RESULTS:" << endl; 
-
-        SatNet network;
-        // insert nodes with values less than the min
-        for (int i = 0; i < 5; i++){
-            Sat satellite(1000 + i);
-            network.insert(satellite);
-        }
-
-        // insert nodes with values greater than the max
-        for (int i = 0; i < 5; i++){
-            Sat satellite(100000 + i);
-            network.insert(satellite);
-        }
-
-        // make sure its still an avl tree
-        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
-            return false; 
-        }
-
-        // nothing should be added
-        if (out(network.m_root) != ""){
-            return false; 
-        }
-        return true; 
-    }
-
-    //Function: insert(const Sat& satellite)
-    //Case: Normal Case
-    //Expected result: resulting tree is balanced as expected
-    bool balanceCheckerInsert() {
-        cout << "TEST 4 RESULTS:" << endl; 
-
-        Random idGen(MINID,MAXID);
-        Random inclinGen(0,3);
-        Random altGen(0,3); 
-
-        // insert 300 random nodes
-        SatNet network;
-        for (int i = 0; i < 1500; i++){
-            Sat satellite(idGen.getRandNum(), static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
-            network.insert(satellite);
-        }
-
-        // check that balance was maintained
-        return balanceChecker(network.m_root);
-    }
-
-    //Function: insert(const Sat& satellite)
-    //Case: Normal Case
-    //Expected result: resulting tree is has BST property
-    bool bstCheckerInsert() {
-        cout << "TEST 5 RESULTS:" << endl; 
-
-        Random idGen(MINID,MAXID);
-        Random inclinGen(0,3);
-        Random altGen(0,3); 
-
-        // insert 300 random nodes
-        SatNet network;
-        for (int i = 0; i < 300; i++){
-            Sat satellite(idGen.getRandNum(), static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
-            network.insert(satellite);
-        }
-        
-        // check that the bst property is maintained
-        return bstChecker(network.m_root);
-    }
-
-    //Function: remove(int id)
-    //Case: Normal Case
-    //Expected result: resulting tree is as expected
-    bool removeNormal() {
-        cout << "TEST 6 RESULTS:" << endl; 
-
-        SatNet network;
-        // insert some nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i);
-            network.insert(satellite);
-        }
-        // remove some 
-        network.remove(10000);
-        network.remove(10001);
-        network.remove(10003);
-
-        // make sure its still an avl tree
-        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
-            return false; 
-        }
-
-        // make sure output was as expected, has the correct nodes
-        if (out(network.m_root) != "((10002:0)10004:1)"){
-            return false;  
-        }
-        return true; 
-    }
-
-    //Function: remove(int id)
-    //Case: Edge Case where nodes are removed that are not in the tree
-    //Expected result: resulting tree is as expected
-    bool removeEdge() {
-        cout << "TEST 7 RESULTS:" << endl; 
-
-        SatNet network;
-        // insert some nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i);
-            network.insert(satellite);
-        }
-        // remove nodes that are not in the tree
-        network.remove(9999);
-        network.remove(10010);
-        network.remove(200000);
-
-        // make sure its still an avl tree, has the correct nodes
-        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
-            return false; 
-        }
-
-        if (out(network.m_root) != "((10000:0)10001:2((10002:0)10003:1(10004:0)))"){
-            return false;  
-        }
-        return true; 
-    }
-
-    //Function: remove(int id)
-    //Case: Normal Case
-    //Expected result: resulting tree is balanced as expected
-    bool balanceCheckerRemove() {
-        cout << "TEST 8 RESULTS:" << endl; 
-
-        Random idGen(MINID,MAXID);
-        Random inclinGen(0,3);
-        Random altGen(0,3); 
-    
-        SatNet network;
-        
-        // insert 300 random nodes
-        int insertedIDs[300];
-        for (int i = 0; i < 1300; i++){
-            insertedIDs[i] = idGen.getRandNum();
-            Sat satellite(insertedIDs[i], static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
-            network.insert(satellite);
-        }
-
-        // remove every other one
-        for (int i = 0; i < 300; i += 2) {
-            network.remove(insertedIDs[i]);
-        }
-        // make sure balance was maintained
-        return balanceChecker(network.m_root);
-    }
-
-    //Function: remove(int id)
-    //Case: Normal Case
-    //Expected result: resulting tree maintains BST property as expected
-    bool bstCheckerRemove() {
-        cout << "TEST 9 RESULTS:" << endl; 
-
-        Random idGen(MINID,MAXID);
-        Random inclinGen(0,3);
-        Random altGen(0,3); 
-    
-        SatNet network;
-        
-        // insert 300 random nodes
-        int insertedIDs[300];
-        for (int i = 0; i < 300; i++){
-            insertedIDs[i] = idGen.getRandNum();
-            Sat satellite(insertedIDs[i], static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
-            network.insert(satellite);
-        }
-
-        // remove every other one
-        for (int i = 0; i < 300; i += 2) {
-            network.remove(insertedIDs[i]);
-        }
-        
-        // make sure BST property was maintained
-        return bstChecker(network.m_root);
-    }
-
-    //Function: removeDeorbited()
-    //Case: Normal Case
-    //Expected result: resulting tree removes deorbited nodes
-    bool removeDeorbitedNormal() {
-        cout << "TEST 10 RESULTS:" << endl; 
-
-        SatNet network;
-        Random idGen(MINID, MAXID);
-        Random inclinGen(0, 3);
-        Random altGen(0, 3);
-
-        // insert some random nodes
-        for (int i = 0; i < 10; ++i) {
-            Sat satellite(idGen.getRandNum(), static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
-            if (i % 2 == 0) {
-                // set some to be deorbited
-                satellite.setState(STATE::DEORBITED);
-            }
-            network.insert(satellite);
-        }
-
-        // remove 
-        network.removeDeorbited();
-
-        // make sure its still an avl tree
-        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
-            return false; 
-        }
-        
-        // make sure that there are no more deorbited nodes
-        return removeDeorbitedChecker(network.m_root); 
-    }
-
-    //Function: removeDeorbited()
-    //Case: Edge case where there are no deorbited nodes
-    //Expected result: resulting tree does not change
-    bool removeDeorbitedEdge() {
-        cout << "TEST 11 RESULTS:" << endl; 
-
-        SatNet network;
-        Random idGen(MINID, MAXID);
-        Random inclinGen(0, 3);
-        Random altGen(0, 3);
-
-        // insert some random nodes where none are defined as deorbited
-        for (int i = 0; i < 10; ++i) {
-            Sat satellite(idGen.getRandNum(), static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
-            network.insert(satellite);
-        }
-
-        string before = out(network.m_root);
-        network.removeDeorbited();
-        string after = out(network.m_root);
-
-        // make sure its still an avl tree
-        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
-            return false; 
-        }
-
-        // make sure that the tree has not been altered
-        if(before != after){
-            return false; 
-        }
-
-        return true; 
-    }
-
-    //Function: countSatellites(INCLIN degree)
-    //Case: Normal Case
-    //Expected result: counts correctly
-    bool countSatellitesNormal() {
-        cout << "TEST 12 RESULTS:" << endl; 
-
-        SatNet network;
-
-        // insert some nodes with incline of I48
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
-            network.insert(satellite);
-            
-        }
-
-        // insert some nodes with incline of I53
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10010 + i, ALT::MI208, INCLIN::I53);
-            network.insert(satellite);
-            
-        }
-        
-        // make sure the count is correct of I48
-        if (network.countSatellites(INCLIN::I48) != 5){
-            return false; 
-        }
-
-        // make sure the count is correct of I53
-        if (network.countSatellites(INCLIN::I53) != 5){
-            return false; 
-        }
-
-        return true; 
-    }
-    
-    //Function: countSatellites(INCLIN degree)
-    //Case: Edge Case where there are no nodes of that degree
-    //Expected result: counts correctly; i.e 0 
-    bool countSatellitesEdge() {
-        cout << "TEST 13 RESULTS:" << endl; 
-
-        SatNet network;
-
-        // insert some nodes with incline of I48
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
-            network.insert(satellite);
-            
-        }
-
-        // insert some nodes with incline of I53
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10010 + i, ALT::MI208, INCLIN::I53);
-            network.insert(satellite);
-            
-        }
-
-        // there should be no nodes of height 70
-        if (network.countSatellites(INCLIN::I70) != 0){
-            return false; 
-        }
-
-        return true; 
-    }
-
-    //Function: findSatellite(int id)
-    //Case: Normal Case
-    //Expected result: returns true
-    bool findSatelliteNormal() {
-        cout << "TEST 14 RESULTS:" << endl; 
-
-        SatNet network;
-        // insert some nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
-            network.insert(satellite);
-            
-        }
-
-        // insert target node
-        Sat satellite(99999, ALT::MI208, INCLIN::I48);
-
-        network.insert(satellite);
-
-        // make sure that target node was found
-        return network.findSatellite(99999);
-    }
-
-    //Function: findSatellite(int id)
-    //Case: Error case where no node of that id is present
-    //Expected result: returns false
-    bool findSatelliteError() {
-        cout << "TEST 15 RESULTS:" << endl; 
-
-        SatNet network;
-        // insert some nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
-            network.insert(satellite);
-            
-        }
-    
-        Sat satellite(99999, ALT::MI208, INCLIN::I48);
-
-        network.insert(satellite);
-
-        // make sure it says that node with id 99998 was not found 
-        return !(network.findSatellite(99998));
-    }
-
-    //Function: operator=(const SatNet & rhs)
-    //Case: Normal Case
-    //Expected result: rhs = lhs
-    bool assignmentNormal() {
-        cout << "TEST 16 RESULTS:" << endl; 
-
-        SatNet network1;
-        // insert some nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i);
-            network1.insert(satellite);
-        }
-        
-        SatNet network2;
-        // insert some nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10010 + i);
-            network2.insert(satellite);
-        }
-        
-        // assign network 1 to network 2
-        network2 = network1;
-
-        // makes sure that they are equal 
-        if (!(isEqual(network1.m_root, network2.m_root))) {
-            return false;
-        }
-
-        // makes sure that this is a deep copy
-        if (&network1 == &network2 || &network1.m_root == &network2.m_root) {
-            return false;
-        }
-         
-        return true;
-    }
-
-    //Function: operator=(const SatNet & rhs)
-    //Case: Error case where rhs and lhs are both empty
-    //Expected result: rhs = lhs, and their m_root is nullptr
-    bool assignmentError() {
-        cout << "TEST 17 RESULTS:" << endl; 
-
-        SatNet network1;
-        SatNet network2;
-
-        network2 = network1;
-
-        // makes sure that the roots are both nullptr
-        if (network1.m_root != nullptr || network2.m_root != nullptr) {
-            return false;
-        }
-
-        // makes sure that they are still equal 
-        if (!(isEqual(network1.m_root, network2.m_root))) {
-            return false;
-        }
-
-        return true;
-    }
-
-    //Function: remove(int id)
-    //Case: Normal Case
-    //Expected result: remove performs in O(logn)
-    bool removePerformanceChecker(){
-        cout << "TEST 18 RESULTS:" << endl; 
-        
-        Random idGen(MINID, MAXID);
-        Random inclinGen(0, 3);
-        Random altGen(0, 3);
-        
-        // set number of nodes
-        const int n1 = 1000;
-        const int n2 = 2000;
-
-        SatNet network1;
-        SatNet network2;
-
-        int insertedID1[n1];
-        int insertedID2[n2];
-
-        // insert n1 random nodes
-        for (int i = 0; i < n1; ++i) {
-            insertedID1[i] = idGen.getRandNum();
-            Sat satellite(insertedID1[i],
-                        static_cast<ALT>(altGen.getRandNum()),
-                        static_cast<INCLIN>(inclinGen.getRandNum()));
-            network1.insert(satellite);
-        }
-
-        // insert n2 random nodes
-        for (int i = 0; i < n2; ++i) {
-            insertedID2[i] = idGen.getRandNum();
-            Sat satellite(insertedID2[i],
-                        static_cast<ALT>(altGen.getRandNum()),
-                        static_cast<INCLIN>(inclinGen.getRandNum()));
-            network2.insert(satellite);
-        }
-
-        // measure the time it takes to remove n1 nodes
-        clock_t start = clock();
-        for (int i = 0; i < n1; ++i) {
-            network1.remove(insertedID1[i]);
-        }
-        clock_t end = clock();      
-        double time1 = static_cast<double>(end - start) / CLOCKS_PER_SEC;
-
-        // measure the time it takes to remove n2 nodes
-        start = clock();
-        for (int i = 0; i < n2; ++i) {
-            network2.remove(insertedID2[i]);
-        }
-        end = clock();
-        double time2 = static_cast<double>(end - start) / CLOCKS_PER_SEC;
-
-        // what is the expected ratio
-        double expectedRatio = (n2*log(n2)) / (2*n1*log(n1));
-
-        // our measured ratio
-        double observedRatio = time2 / (2*time1);
-
-        cout << "Expected Ratio: " << expectedRatio << endl;
-        cout << "Observed Ratio: " << observedRatio << endl;
-
-        double errorMargin = 0.4;
-        double lowerBound = expectedRatio - errorMargin;
-        double upperBound = expectedRatio + errorMargin;
-
-        // make sure that the result in within the error margins
-        if (!(observedRatio >= lowerBound && observedRatio <= upperBound)) {
-            return false;
-        } 
-        return true;
-    }
-
-    //Function: insert(const Sat& satellite)
-    //Case: Normal Case
-    //Expected result: insert performs in O(logn)
-    bool insertPerformanceChecker(){
-        cout << "TEST 19 RESULTS:" << endl; 
-
-        Random idGen(MINID, MAXID);
-        Random inclinGen(0, 3);
-        Random altGen(0, 3);
-
-        // set number of nodes
-        const int n1 = 1000;
-        const int n2 = 2000;
-
-        SatNet network1;
-        SatNet network2;
-
-        // measure the amount of time it takes to insert n1 nodes
-        clock_t start = clock();
-        for (int i = 0; i < n1; ++i) {
-            int ID = idGen.getRandNum();
-            Sat satellite(ID,
-                        static_cast<ALT>(altGen.getRandNum()),
-                        static_cast<INCLIN>(inclinGen.getRandNum()));
-            network1.insert(satellite);
-        }
-        
-        clock_t end = clock();      
-        double time1 = static_cast<double>(end - start) / CLOCKS_PER_SEC;
-
-        // measure the amount of time it takes to insert n2 nodes
-        start = clock();
-        for (int i = 0; i < n2; ++i) {
-            int ID = idGen.getRandNum();
-            Sat satellite(ID,
-                        static_cast<ALT>(altGen.getRandNum()),
-                        static_cast<INCLIN>(inclinGen.getRandNum()));
-            network2.insert(satellite);
-        }
-
-        end = clock();
-        double time2 = static_cast<double>(end - start) / CLOCKS_PER_SEC;
-
-        // what is the expected ratio
-        double expectedRatio = (n2*log(n2)) / (2*n1*log(n1));
-
-        // our measured ratio
-        double observedRatio = time2 / (2*time1);
-
-        cout << "Expected Ratio: " << expectedRatio << endl;
-        cout << "Observed Ratio: " << observedRatio << endl;
-
-        double errorMargin = 0.4;
-        double lowerBound = expectedRatio - errorMargin;
-        double upperBound = expectedRatio + errorMargin;
-        
-        // make sure that the result in within the error margins
-        if (!(observedRatio >= lowerBound && observedRatio <= upperBound)) {
-            return false;
-        } 
-        return true;
-    }
-
-    //Function: setState(int id, STATE state)
-    //Case: Normal Case
-    //Expected result: returns true
-    bool setStateNormal(){
-        cout << "TEST 20 RESULTS:" << endl; 
-
-        SatNet network;
-
-        // insert some nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
-            network.insert(satellite);
-            
-        }
-
-        // make a special satellite with default state active
-        Sat satellite(99999);
-        network.insert(satellite);
-
-        // turn it into deorbited
-        if (!network.setState(99999, STATE::DEORBITED)){
-            return false; 
-        }
-
-        // should be gone after this
-        network.removeDeorbited();
-
-        // should not be able to find the node
-        if(network.findSatellite(99999)){
-            return false; 
-        }
-
-        return true; 
-    }
-
-    //Function: setState(int id, STATE state)
-    //Case: Edge Case
-    //Expected result: returns false
-    bool setStateEdge(){
-        cout << "TEST 21 RESULTS:" << endl; 
-
-        SatNet network;
-
-        // insert some nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
-            network.insert(satellite);
-            
-        }
-
-        // call setState on a node thats not in the tree
-        if (network.setState(99999, STATE::DEORBITED)){
-            return false; 
-        }
-
-        return true; 
-    }
-
-    //Function: clear()
-    //Case: Normal case
-    //Expected result: makes object empty
-    bool clearNormal(){
-        cout << "TEST 22 RESULTS:" << endl; 
-
-        SatNet network;
-
-        // insert some nodes
-        for (int i = 0; i < 5; i++){
-            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
-            network.insert(satellite);
-            
-        }
-
-        network.clear();
-
-        if (network.m_root != nullptr){
-            return false; 
-        }
-
-        return true; 
-    }
-
-    //Function: clear()
-    //Case: Edge case
-    //Expected result: keeps empty object empty
-    bool clearEdge(){
-        cout << "TEST 23 RESULTS:" << endl; 
-
-        SatNet network;
-
-        network.clear();
-
-        if (network.m_root != nullptr){
-            return false; 
-        }
-
-        return true; 
-    }
-
-    private:
-    
-    /**********************************************
-    * If we need helper functions to be reused in *
-    *   test functions they can be declared here!
-    **********************************************/
-
-    // this helper outputs all the nodes in the tree
-    string out(Sat* satellite) const{
-        string result = "";
-        if (satellite != nullptr){
-            result += "(";
-            result += out(satellite->m_left);  // first visit the left child
-            result += to_string(satellite->m_id) + ":" + to_string(satellite->m_height);  // second visit the node itself
-            result += out(satellite->m_right);  // third visit the right child
-            result += ")";
-        }
-        return result; 
-    }
-    
-    // this helper makes sure that the tree is balanced
-    bool balanceChecker(Sat* node) {
-        // base case
-        if (node == nullptr) {
-            return true;
-        }
-        
-        // initilaize varaibles
-        int leftHeight = -1;
-        int rightHeight = -1;
-        
-        if (node->m_left != nullptr) {
-            leftHeight = node->m_left->m_height;
-        }
-
-        if (node->m_right != nullptr) {
-            rightHeight = node->m_right->m_height;
-        }
-        
-        // make sure that the difference is less than 1
-        if (abs(leftHeight - rightHeight) <= 1) {
-            // recursive call 
-            if (balanceChecker(node->m_left) && balanceChecker(node->m_right)) {
-                return true;
-            }
-        }
-    
-        return false;
-    }
-
-    // this helper makes sure that the bst property is maintained
-    bool bstChecker(Sat* node, Sat* min = nullptr, Sat* max = nullptr) {
-        // an empty network is a binary seach network by definition
-        if (node == nullptr) {
-            return true;
-        }
-
-        // check if the value is bounded by the max and min
-        if (min != nullptr && node->getID() <= min->getID()) {
-            return false;
-        }
-        if (max != nullptr && node->getID() >= max->getID()) {
-            return false;
-        }
-
-        // recursive call 
-        if (bstChecker(node->m_left, min, node) && bstChecker(node->m_right, node, max)){
-            return true; 
-        }
-
-        return false;
-    }
-    
-    // this makes sure that none of the nodes have the deorbited state
-    bool removeDeorbitedChecker(Sat* node) {
-        // base case
-        if (node == nullptr) {
-            return true;
-        }
-        
-        // if deorbited state is present set as false
-        if (node->getState() == DEORBITED) {
-            return false;
-        }
-        
-        // recurse on rhs and lhs
-        if (!removeDeorbitedChecker(node->m_left) || !removeDeorbitedChecker(node->m_right)) {
-            return false;
-        }
-
-        return true;
-    }
-
-    // makes sure that two given trees are equal 
-    bool isEqual(const Sat* node1, const Sat* node2) const {
-        // base case
-        if (node1 == nullptr && node2 == nullptr) {
-            return true;
-        }
-
-        // if one of them is nullptr and the other is not
-        if (node1 == nullptr || node2 == nullptr) {
-            return false;
-        }
-        
-        // see if all the member vairables are the same
-        if (node1->getID() != node2->getID() ||
-            node1->getAlt() != node2->getAlt() ||
-            node1->getInclin() != node2->getInclin() ||
-            node1->getState() != node2->getState()) {
-            return false;
-        }
-        
-        // recurse on rhs and lhs
-        return isEqual(node1->m_left, node2->m_left) && isEqual(node1->m_right, node2->m_right);
-    }
-
-};
-
-int main(){
-    Tester tester;
-
-    cout << endl << "\033[1;31m=============================|Test Cases for the SATNET Class|==============================\033[0m" << endl;
-
-    cout << "________________________________________________________" << endl; 
-    
-    cout << "Test the insertion function for a normal case." << endl; 
-
-    if (tester.insertNormal()) {
-        cout << "\033[1;32mSUCCESS\033[0m insert function passed for a normal test" << endl;
-    } 
-    else {
-        cout << "FAILURE: insert function failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-    
-    cout << "Test the insertion function for a edge case where duplicates are inserted." << endl; 
-
-    if (tester.insertEdge()) {
-        cout << "\033[1;32mSUCCESS\033[0m insert function passed for a edge test" << endl;
-    } 
-    else {
-        cout << "FAILURE: insert function failed for a edge test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-    
-    cout << "Test the insertion function for a error case where nodes with invalid IDs are inserted." << endl; 
-
-    if (tester.insertError()) {
-        cout << "\033[1;32mSUCCESS\033[0m insert function passed for a error test" << endl;
-    } 
-    else {
-        cout << "FAILURE: insert function failed for a error test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-    
-    cout << "Test whether the network is balanced after a decent number of insertions, e.g. 300 insertions." << endl; 
-
-    if (tester.balanceCheckerInsert()) {
-        cout << "\033[1;32mSUCCESS\033[0m balance check passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: balance check failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-    
-    cout << "Test whether the BST property is preserved after all insertions. (Note: this requires visiting all nodes and comparing key values)" << endl; 
-
-    if (tester.bstCheckerInsert()) {
-        cout << "\033[1;32mSUCCESS\033[0m BST check passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: BST check failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the remove function for a normal case." << endl; 
-
-    if (tester.removeNormal()) {
-        cout << "\033[1;32mSUCCESS\033[0m remove function passed for a normal test" << endl;
-    } 
-    else {
-        cout << "FAILURE: remove function failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the remove function for a edge case where you are removing values that don't exist." << endl; 
-
-    if (tester.removeEdge()) {
-        cout << "\033[1;32mSUCCESS\033[0m remove function passed for a edge test" << endl;
-    } 
-    else {
-        cout << "FAILURE: remove function failed for a edge test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test whether the network is balanced after multiple removals. For example, insert 300 nodes, then remove 150, and check the property." << endl; 
-
-    if (tester.balanceCheckerRemove()) {
-        cout << "\033[1;32mSUCCESS\033[0m balance check passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: balance check failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test whether the BST property is preserved after multiple removals." << endl; 
-
-    if (tester.bstCheckerRemove()) {
-        cout << "\033[1;32mSUCCESS\033[0m BST check passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: BST check failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the removeDeorbited() functionality for a normal test" << endl; 
-
-    if (tester.removeDeorbitedNormal()) {
-        cout << "\033[1;32mSUCCESS\033[0m RemoveDeorbited passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: RemoveDeorbited failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the removeDeorbited() functionality for a edge test where there are no deorbited nodes" << endl; 
-
-    if (tester.removeDeorbitedEdge()) {
-        cout << "\033[1;32mSUCCESS\033[0m RemoveDeorbited passed for a edge test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: RemoveDeorbited failed for a edge test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the countSatellites() functionality for a normal case" << endl; 
-
-    if (tester.countSatellitesNormal()) {
-        cout << "\033[1;32mSUCCESS\033[0m countSatellites passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: countSatellites failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the countSatellites() functionality for a edge case where no satellites of that incline are there" << endl; 
-
-    if (tester.countSatellitesEdge()) {
-        cout << "\033[1;32mSUCCESS\033[0m countSatellites passed for a edge test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: countSatellites failed for a edge test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the findSatellite(...) functionality for a normal case." << endl; 
-
-    if (tester.findSatelliteNormal()) {
-        cout << "\033[1;32mSUCCESS\033[0m findSatellite passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: findSatellite failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the findSatellite(...) functionality for a error case where no such node exists" << endl; 
-
-    if (tester.findSatelliteError()) {
-        cout << "\033[1;32mSUCCESS\033[0m findSatellite passed for a error test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: findSatellite failed for a error test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the assignment operator for a normal case." << endl; 
-
-    if (tester.assignmentNormal()) {
-        cout << "\033[1;32mSUCCESS\033[0m assignment operator passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: assignment operator failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the assignment operator for an error case, e.g. assigning an empty object to an empty object." << endl; 
-
-    if (tester.assignmentError()) {
-        cout << "\033[1;32mSUCCESS\033[0m assignment operator passed for a error test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: assignment operator failed for a error test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Prove that the removal performs in O(log n). " << endl; 
-
-    if (tester.removePerformanceChecker()) {
-        cout << "\033[1;32mSUCCESS\033[0m The removal passed for a time complexity test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: The removal failed for a time complexity test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Prove that the insertion performs in O(log n). " << endl; 
-
-    if (tester.insertPerformanceChecker()) {
-        cout << "\033[1;32mSUCCESS\033[0m The insertion passed for a time complexity test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: The insertion failed for a time complexity test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the setState functionality for a normal case" << endl; 
-
-    if (tester.setStateNormal()) {
-        cout << "\033[1;32mSUCCESS\033[0m setState passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: setState failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the setState functionality for a edge case where it was called on a node that was not in the tree" << endl; 
-
-    if (tester.setStateEdge()) {
-        cout << "\033[1;32mSUCCESS\033[0m setState passed for a edge test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: setState failed for a edge test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the clear functionality for a normal case" << endl; 
-
-    if (tester.clearNormal()) {
-        cout << "\033[1;32mSUCCESS\033[0m clear passed for a normal test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: clear failed for a normal test" << endl;
-    }
-
-    cout << "________________________________________________________" << endl; 
-
-    cout << "Test the clear functionality for a edge case where the network was already empty" << endl; 
-
-    if (tester.clearEdge()) {
-        cout << "\033[1;32mSUCCESS\033[0m clear passed for a edge test"<< endl;
-    } 
-    else {
-        cout << "FAILURE: clear failed for a edge test" << endl;
-    }
-    
-    return 0;
-}
+// Title: mytest.cpp
+// Author: Andrew Tang
+// Date: 9/15/2023
+// Description: This is a tester file for satnet.cpp
+
+#include "satnet.h"
+#include "random.h"
+#include "trace.h"
+#include "workload.h"
+#include "taskpool.h"
+#include "asyncnet.h"
+#include "reclaimer.h"
+#include "cdc.h"
+#include "mappednet.h"
+#include "snapshot.h"
+#include "catalog.h"
+#include <unistd.h>
+#include <sys/wait.h>
+#include <math.h>
+#include <fstream>
+using namespace std; 
+
+// the payload of the generic catalog test, a piece of tracked debris
+class Debris{
+    public:
+    Debris(double mass = 0) : m_mass(mass) {}
+    double getMass() const {return m_mass;}
+    private:
+    double m_mass;
+};
+
+class Tester{
+    public:
+
+    // ==================================================| Test Cases for the SATNET Class |============================================================
+    //Function: insert(const Sat& satellite)
+    //Case: Normal Case
+    //Expected result: resulting tree is as expected
+    bool insertNormal() {
+        cout << "TEST 1 RESULTS:" << endl; 
+
+        SatNet network;
+        // insert in nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i);
+            network.insert(satellite);
+        }
+
+        // make sure its still an avl tree
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
+            return false; 
+        }
+
+        // make sure that output is as expected, has the correct nodes
+        if (out(network.m_root) != "((10000:0)10001:2((10002:0)10003:1(10004:0)))"){
+            return false;  
+        }
+        return true; 
+    }
+
+    //Function: insert(const Sat& satellite)
+    //Case: Edge case where duplicates are inserted
+    //Expected result: resulting tree is as expected, duplicates are not inserted
+    bool insertEdge() {
+        cout << "TEST 2 RESULTS:" << endl; 
+
+        SatNet network;
+        // insert in nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i);
+            network.insert(satellite);
+        }
+
+        // inserts the same node
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i);
+            network.insert(satellite);
+        }
+
+        // make sure its still an avl tree
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
+            return false; 
+        }
+
+        // make sure that duplicates are handled by being not added, has the correct nodes
+        if (out(network.m_root) != "((10000:0)10001:2((10002:0)10003:1(10004:0)))"){
+            return false; 
+        }
+        return true; 
+    }
+
+    //Function: insert(const Sat& satellite)
+    //Case: Error Case where nodes have invalid IDs are inserted
+    //Expected result: resulting tree is as expected, nothing is inserted
+    bool insertError() {
+        cout << "TEST 3 RESULTS:" << endl; 
+
+        SatNet network;
+        // insert nodes with values less than the min
+        for (int i = 0; i < 5; i++){
+            Sat satellite(1000 + i);
+            network.insert(satellite);
+        }
+
+        // insert nodes with values greater than the max
+        for (int i = 0; i < 5; i++){
+            Sat satellite(100000 + i);
+            network.insert(satellite);
+        }
+
+        // make sure its still an avl tree
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
+            return false; 
+        }
+
+        // nothing should be added
+        if (out(network.m_root) != ""){
+            return false; 
+        }
+        return true; 
+    }
+
+    //Function: insert(const Sat& satellite)
+    //Case: Normal Case
+    //Expected result: resulting tree is balanced as expected
+    bool balanceCheckerInsert() {
+        cout << "TEST 4 RESULTS:" << endl; 
+
+        Random idGen(MINID,MAXID);
+        Random inclinGen(0,3);
+        Random altGen(0,3); 
+
+        // insert 300 random nodes
+        SatNet network;
+        for (int i = 0; i < 1500; i++){
+            Sat satellite(idGen.getRandNum(), static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
+            network.insert(satellite);
+        }
+
+        // check that balance was maintained
+        return balanceChecker(network.m_root);
+    }
+
+    //Function: insert(const Sat& satellite)
+    //Case: Normal Case
+    //Expected result: resulting tree is has BST property
+    bool bstCheckerInsert() {
+        cout << "TEST 5 RESULTS:" << endl; 
+
+        Random idGen(MINID,MAXID);
+        Random inclinGen(0,3);
+        Random altGen(0,3); 
+
+        // insert 300 random nodes
+        SatNet network;
+        for (int i = 0; i < 300; i++){
+            Sat satellite(idGen.getRandNum(), static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
+            network.insert(satellite);
+        }
+        
+        // check that the bst property is maintained
+        return bstChecker(network.m_root);
+    }
+
+    //Function: remove(int id)
+    //Case: Normal Case
+    //Expected result: resulting tree is as expected
+    bool removeNormal() {
+        cout << "TEST 6 RESULTS:" << endl; 
+
+        SatNet network;
+        // insert some nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i);
+            network.insert(satellite);
+        }
+        // remove some 
+        network.remove(10000);
+        network.remove(10001);
+        network.remove(10003);
+
+        // make sure its still an avl tree
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
+            return false; 
+        }
+
+        // make sure output was as expected, has the correct nodes
+        if (out(network.m_root) != "((10002:0)10004:1)"){
+            return false;  
+        }
+        return true; 
+    }
+
+    //Function: remove(int id)
+    //Case: Edge Case where nodes are removed that are not in the tree
+    //Expected result: resulting tree is as expected
+    bool removeEdge() {
+        cout << "TEST 7 RESULTS:" << endl; 
+
+        SatNet network;
+        // insert some nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i);
+            network.insert(satellite);
+        }
+        // remove nodes that are not in the tree
+        network.remove(9999);
+        network.remove(10010);
+        network.remove(200000);
+
+        // make sure its still an avl tree, has the correct nodes
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
+            return false; 
+        }
+
+        if (out(network.m_root) != "((10000:0)10001:2((10002:0)10003:1(10004:0)))"){
+            return false;  
+        }
+        return true; 
+    }
+
+    //Function: remove(int id)
+    //Case: Normal Case
+    //Expected result: resulting tree is balanced as expected
+    bool balanceCheckerRemove() {
+        cout << "TEST 8 RESULTS:" << endl; 
+
+        Random idGen(MINID,MAXID);
+        Random inclinGen(0,3);
+        Random altGen(0,3); 
+    
+        SatNet network;
+        
+        // insert 300 random nodes
+        int insertedIDs[300];
+        for (int i = 0; i < 300; i++){
+            insertedIDs[i] = idGen.getRandNum();
+            Sat satellite(insertedIDs[i], static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
+            network.insert(satellite);
+        }
+
+        // remove every other one
+        for (int i = 0; i < 300; i += 2) {
+            network.remove(insertedIDs[i]);
+        }
+        // make sure balance was maintained
+        return balanceChecker(network.m_root);
+    }
+
+    //Function: remove(int id)
+    //Case: Normal Case
+    //Expected result: resulting tree maintains BST property as expected
+    bool bstCheckerRemove() {
+        cout << "TEST 9 RESULTS:" << endl; 
+
+        Random idGen(MINID,MAXID);
+        Random inclinGen(0,3);
+        Random altGen(0,3); 
+    
+        SatNet network;
+        
+        // insert 300 random nodes
+        int insertedIDs[300];
+        for (int i = 0; i < 300; i++){
+            insertedIDs[i] = idGen.getRandNum();
+            Sat satellite(insertedIDs[i], static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
+            network.insert(satellite);
+        }
+
+        // remove every other one
+        for (int i = 0; i < 300; i += 2) {
+            network.remove(insertedIDs[i]);
+        }
+        
+        // make sure BST property was maintained
+        return bstChecker(network.m_root);
+    }
+
+    //Function: removeDeorbited()
+    //Case: Normal Case
+    //Expected result: resulting tree removes deorbited nodes
+    bool removeDeorbitedNormal() {
+        cout << "TEST 10 RESULTS:" << endl; 
+
+        SatNet network;
+        Random idGen(MINID, MAXID);
+        Random inclinGen(0, 3);
+        Random altGen(0, 3);
+
+        // insert some random nodes
+        for (int i = 0; i < 10; ++i) {
+            Sat satellite(idGen.getRandNum(), static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
+            if (i % 2 == 0) {
+                // set some to be deorbited
+                satellite.setState(STATE::DEORBITED);
+            }
+            network.insert(satellite);
+        }
+
+        // remove 
+        network.removeDeorbited();
+
+        // make sure its still an avl tree
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
+            return false; 
+        }
+        
+        // make sure that there are no more deorbited nodes
+        return removeDeorbitedChecker(network.m_root); 
+    }
+
+    //Function: removeDeorbited()
+    //Case: Edge case where there are no deorbited nodes
+    //Expected result: resulting tree does not change
+    bool removeDeorbitedEdge() {
+        cout << "TEST 11 RESULTS:" << endl; 
+
+        SatNet network;
+        Random idGen(MINID, MAXID);
+        Random inclinGen(0, 3);
+        Random altGen(0, 3);
+
+        // insert some random nodes where none are defined as deorbited
+        for (int i = 0; i < 10; ++i) {
+            Sat satellite(idGen.getRandNum(), static_cast<ALT>(altGen.getRandNum()), static_cast<INCLIN>(inclinGen.getRandNum()));
+            network.insert(satellite);
+        }
+
+        string before = out(network.m_root);
+        network.removeDeorbited();
+        string after = out(network.m_root);
+
+        // make sure its still an avl tree
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
+            return false; 
+        }
+
+        // make sure that the tree has not been altered
+        if(before != after){
+            return false; 
+        }
+
+        return true; 
+    }
+
+    //Function: countSatellites(INCLIN degree)
+    //Case: Normal Case
+    //Expected result: counts correctly
+    bool countSatellitesNormal() {
+        cout << "TEST 12 RESULTS:" << endl; 
+
+        SatNet network;
+
+        // insert some nodes with incline of I48
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
+            network.insert(satellite);
+            
+        }
+
+        // insert some nodes with incline of I53
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10010 + i, ALT::MI208, INCLIN::I53);
+            network.insert(satellite);
+            
+        }
+        
+        // make sure the count is correct of I48
+        if (network.countSatellites(INCLIN::I48) != 5){
+            return false; 
+        }
+
+        // make sure the count is correct of I53
+        if (network.countSatellites(INCLIN::I53) != 5){
+            return false; 
+        }
+
+        return true; 
+    }
+    
+    //Function: countSatellites(INCLIN degree)
+    //Case: Edge Case where there are no nodes of that degree
+    //Expected result: counts correctly; i.e 0 
+    bool countSatellitesEdge() {
+        cout << "TEST 13 RESULTS:" << endl; 
+
+        SatNet network;
+
+        // insert some nodes with incline of I48
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
+            network.insert(satellite);
+            
+        }
+
+        // insert some nodes with incline of I53
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10010 + i, ALT::MI208, INCLIN::I53);
+            network.insert(satellite);
+            
+        }
+
+        // there should be no nodes of height 70
+        if (network.countSatellites(INCLIN::I70) != 0){
+            return false; 
+        }
+
+        return true; 
+    }
+
+    //Function: findSatellite(int id)
+    //Case: Normal Case
+    //Expected result: returns true
+    bool findSatelliteNormal() {
+        cout << "TEST 14 RESULTS:" << endl; 
+
+        SatNet network;
+        // insert some nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
+            network.insert(satellite);
+            
+        }
+
+        // insert target node
+        Sat satellite(99999, ALT::MI208, INCLIN::I48);
+
+        network.insert(satellite);
+
+        // make sure that target node was found
+        return network.findSatellite(99999);
+    }
+
+    //Function: findSatellite(int id)
+    //Case: Error case where no node of that id is present
+    //Expected result: returns false
+    bool findSatelliteError() {
+        cout << "TEST 15 RESULTS:" << endl; 
+
+        SatNet network;
+        // insert some nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
+            network.insert(satellite);
+            
+        }
+    
+        Sat satellite(99999, ALT::MI208, INCLIN::I48);
+
+        network.insert(satellite);
+
+        // make sure it says that node with id 99998 was not found 
+        return !(network.findSatellite(99998));
+    }
+
+    //Function: operator=(const SatNet & rhs)
+    //Case: Normal Case
+    //Expected result: rhs = lhs
+    bool assignmentNormal() {
+        cout << "TEST 16 RESULTS:" << endl; 
+
+        SatNet network1;
+        // insert some nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i);
+            network1.insert(satellite);
+        }
+        
+        SatNet network2;
+        // insert some nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10010 + i);
+            network2.insert(satellite);
+        }
+        
+        // assign network 1 to network 2
+        network2 = network1;
+
+        // makes sure that they are equal 
+        if (!(isEqual(network1.m_root, network2.m_root))) {
+            return false;
+        }
+
+        // makes sure that this is a deep copy
+        if (&network1 == &network2 || &network1.m_root == &network2.m_root) {
+            return false;
+        }
+         
+        return true;
+    }
+
+    //Function: operator=(const SatNet & rhs)
+    //Case: Error case where rhs and lhs are both empty
+    //Expected result: rhs = lhs, and their m_root is nullptr
+    bool assignmentError() {
+        cout << "TEST 17 RESULTS:" << endl; 
+
+        SatNet network1;
+        SatNet network2;
+
+        network2 = network1;
+
+        // makes sure that the roots are both nullptr
+        if (network1.m_root != nullptr || network2.m_root != nullptr) {
+            return false;
+        }
+
+        // makes sure that they are still equal 
+        if (!(isEqual(network1.m_root, network2.m_root))) {
+            return false;
+        }
+
+        return true;
+    }
+
+    //Function: remove(int id)
+    //Case: Normal Case
+    //Expected result: remove performs in O(logn)
+    bool removePerformanceChecker(){
+        cout << "TEST 18 RESULTS:" << endl; 
+        
+        Random idGen(MINID, MAXID);
+        Random inclinGen(0, 3);
+        Random altGen(0, 3);
+        
+        // set number of nodes
+        const int n1 = 1000;
+        const int n2 = 2000;
+
+        SatNet network1;
+        SatNet network2;
+
+        int insertedID1[n1];
+        int insertedID2[n2];
+
+        // insert n1 random nodes
+        for (int i = 0; i < n1; ++i) {
+            insertedID1[i] = idGen.getRandNum();
+            Sat satellite(insertedID1[i],
+                        static_cast<ALT>(altGen.getRandNum()),
+                        static_cast<INCLIN>(inclinGen.getRandNum()));
+            network1.insert(satellite);
+        }
+
+        // insert n2 random nodes
+        for (int i = 0; i < n2; ++i) {
+            insertedID2[i] = idGen.getRandNum();
+            Sat satellite(insertedID2[i],
+                        static_cast<ALT>(altGen.getRandNum()),
+                        static_cast<INCLIN>(inclinGen.getRandNum()));
+            network2.insert(satellite);
+        }
+
+        // measure the time it takes to remove n1 nodes
+        clock_t start = clock();
+        for (int i = 0; i < n1; ++i) {
+            network1.remove(insertedID1[i]);
+        }
+        clock_t end = clock();      
+        double time1 = static_cast<double>(end - start) / CLOCKS_PER_SEC;
+
+        // measure the time it takes to remove n2 nodes
+        start = clock();
+        for (int i = 0; i < n2; ++i) {
+            network2.remove(insertedID2[i]);
+        }
+        end = clock();
+        double time2 = static_cast<double>(end - start) / CLOCKS_PER_SEC;
+
+        // what is the expected ratio
+        double expectedRatio = (n2*log(n2)) / (2*n1*log(n1));
+
+        // our measured ratio
+        double observedRatio = time2 / (2*time1);
+
+        cout << "Expected Ratio: " << expectedRatio << endl;
+        cout << "Observed Ratio: " << observedRatio << endl;
+
+        double errorMargin = 0.4;
+        double lowerBound = expectedRatio - errorMargin;
+        double upperBound = expectedRatio + errorMargin;
+
+        // make sure that the result in within the error margins
+        if (!(observedRatio >= lowerBound && observedRatio <= upperBound)) {
+            return false;
+        } 
+        return true;
+    }
+
+    //Function: insert(const Sat& satellite)
+    //Case: Normal Case
+    //Expected result: insert performs in O(logn)
+    bool insertPerformanceChecker(){
+        cout << "TEST 19 RESULTS:" << endl; 
+
+        Random idGen(MINID, MAXID);
+        Random inclinGen(0, 3);
+        Random altGen(0, 3);
+
+        // set number of nodes
+        const int n1 = 1000;
+        const int n2 = 2000;
+
+        SatNet network1;
+        SatNet network2;
+
+        // measure the amount of time it takes to insert n1 nodes
+        clock_t start = clock();
+        for (int i = 0; i < n1; ++i) {
+            int ID = idGen.getRandNum();
+            Sat satellite(ID,
+                        static_cast<ALT>(altGen.getRandNum()),
+                        static_cast<INCLIN>(inclinGen.getRandNum()));
+            network1.insert(satellite);
+        }
+        
+        clock_t end = clock();      
+        double time1 = static_cast<double>(end - start) / CLOCKS_PER_SEC;
+
+        // measure the amount of time it takes to insert n2 nodes
+        start = clock();
+        for (int i = 0; i < n2; ++i) {
+            int ID = idGen.getRandNum();
+            Sat satellite(ID,
+                        static_cast<ALT>(altGen.getRandNum()),
+                        static_cast<INCLIN>(inclinGen.getRandNum()));
+            network2.insert(satellite);
+        }
+
+        end = clock();
+        double time2 = static_cast<double>(end - start) / CLOCKS_PER_SEC;
+
+        // what is the expected ratio
+        double expectedRatio = (n2*log(n2)) / (2*n1*log(n1));
+
+        // our measured ratio
+        double observedRatio = time2 / (2*time1);
+
+        cout << "Expected Ratio: " << expectedRatio << endl;
+        cout << "Observed Ratio: " << observedRatio << endl;
+
+        double errorMargin = 0.4;
+        double lowerBound = expectedRatio - errorMargin;
+        double upperBound = expectedRatio + errorMargin;
+        
+        // make sure that the result in within the error margins
+        if (!(observedRatio >= lowerBound && observedRatio <= upperBound)) {
+            return false;
+        } 
+        return true;
+    }
+
+    //Function: setState(int id, STATE state)
+    //Case: Normal Case
+    //Expected result: returns true
+    bool setStateNormal(){
+        cout << "TEST 20 RESULTS:" << endl; 
+
+        SatNet network;
+
+        // insert some nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
+            network.insert(satellite);
+            
+        }
+
+        // make a special satellite with default state active
+        Sat satellite(99999);
+        network.insert(satellite);
+
+        // turn it into deorbited
+        if (!network.setState(99999, STATE::DEORBITED)){
+            return false; 
+        }
+
+        // should be gone after this
+        network.removeDeorbited();
+
+        // should not be able to find the node
+        if(network.findSatellite(99999)){
+            return false; 
+        }
+
+        return true; 
+    }
+
+    //Function: setState(int id, STATE state)
+    //Case: Edge Case
+    //Expected result: returns false
+    bool setStateEdge(){
+        cout << "TEST 21 RESULTS:" << endl; 
+
+        SatNet network;
+
+        // insert some nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
+            network.insert(satellite);
+            
+        }
+
+        // call setState on a node thats not in the tree
+        if (network.setState(99999, STATE::DEORBITED)){
+            return false; 
+        }
+
+        return true; 
+    }
+
+    //Function: clear()
+    //Case: Normal case
+    //Expected result: makes object empty
+    bool clearNormal(){
+        cout << "TEST 22 RESULTS:" << endl; 
+
+        SatNet network;
+
+        // insert some nodes
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i, ALT::MI208, INCLIN::I48);
+            network.insert(satellite);
+            
+        }
+
+        network.clear();
+
+        if (network.m_root != nullptr){
+            return false; 
+        }
+
+        return true; 
+    }
+
+    //Function: clear()
+    //Case: Edge case
+    //Expected result: keeps empty object empty
+    bool clearEdge(){
+        cout << "TEST 23 RESULTS:" << endl; 
+
+        SatNet network;
+
+        network.clear();
+
+        if (network.m_root != nullptr){
+            return false; 
+        }
+
+        return true; 
+    }
+
+    //Function: SatNet(SatID minID, SatID maxID) and insert(const Sat& satellite)
+    //Case: Normal case with a sparse 64-bit id range holding more than 90k satellites
+    //Expected result: every satellite is inserted and the tree stays a balanced BST
+    bool wideIDNormal(){
+        cout << "TEST 24 RESULTS:" << endl; 
+
+        const SatID minID = 1000000000000LL;
+        const SatID maxID = 9000000000000LL;
+        const int n = 150000;
+
+        SatNet network(minID, maxID);
+        // insert ids far apart from each other, well past the default MAXID
+        for (int i = 0; i < n; i++){
+            Sat satellite(minID + SatID(i) * 40000007LL, static_cast<ALT>(i % 4), static_cast<INCLIN>(i % 4));
+            network.insert(satellite);
+        }
+
+        // make sure its still an avl tree
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
+            return false; 
+        }
+
+        // every id must be there, 4 of them are counted per inclination
+        for (int i = 0; i < n; i += 997){
+            if (!network.findSatellite(minID + SatID(i) * 40000007LL)){
+                return false; 
+            }
+        }
+        if (network.countSatellites(I53) != n / 4){
+            return false; 
+        }
+
+        // an avl tree with n nodes has a height below 1.44 log2(n)
+        return network.m_root->m_height <= 1.44 * log2(n);
+    }
+
+    //Function: SatNet(SatID minID, SatID maxID) and insert(const Sat& satellite)
+    //Case: Error case where ids outside of the custom range are inserted
+    //Expected result: only the ids inside the range are inserted
+    bool wideIDError(){
+        cout << "TEST 25 RESULTS:" << endl; 
+
+        SatNet network(5000000000LL, 5000000010LL);
+        network.insert(Sat(10000));
+        network.insert(Sat(4999999999LL));
+        network.insert(Sat(5000000011LL));
+        network.insert(Sat(5000000000LL));
+        network.insert(Sat(5000000010LL));
+
+        if (out(network.m_root) != "(5000000000:1(5000000010:0))"){
+            return false; 
+        }
+
+        // the range is copied by the assignment operator
+        SatNet copy;
+        copy = network;
+        copy.insert(Sat(5000000005LL));
+        copy.insert(Sat(10001));
+        return copy.findSatellite(5000000005LL) && !copy.findSatellite(10001);
+    }
+
+    //Function: stats()
+    //Case: Normal case
+    //Expected result: the shape of the tree and the counters match the operations performed
+    bool statsNormal(){
+        cout << "TEST 26 RESULTS:" << endl; 
+
+        SatNet network;
+        // insert some nodes, this takes two left rotations
+        for (int i = 0; i < 5; i++){
+            Sat satellite(10000 + i);
+            network.insert(satellite);
+        }
+
+        // the tree is ((10000:0)10001:2((10002:0)10003:1(10004:0)))
+        SatStats result = network.stats();
+        if (result.nodeCount != 5 || result.height != 2 || fabs(result.averageDepth - 1.2) > 1e-9){
+            return false; 
+        }
+        if (result.bytesUsed != (long long)(sizeof(SatNet) + 5 * sizeof(Sat))){
+            return false; 
+        }
+#ifdef SATNET_STATS
+        if (result.allocations != 5 || result.leftRotations != 2 || result.rightRotations != 0 ||
+            result.doubleRotations != 0 || result.descents[OP_INSERT] != 5 || result.comparisons == 0){
+            return false; 
+        }
+        // the 5 inserts visited 0 + 1 + 2 + 2 + 3 nodes before their new leaf, a find of the root visits 1 and one of 9999
+        // visits 2 on its way down the left edge
+        network.findSatellite(10001);
+        network.findSatellite(MINID - 1);
+        result = network.stats();
+        if (result.descentDepth[OP_INSERT] != 8 || result.descents[OP_FIND] != 2 || result.descentDepth[OP_FIND] != 3 ||
+            result.descents[OP_REMOVE] != 0 || result.descentDepth[OP_SETSTATE] != 0){
+            return false; 
+        }
+        // removing everything frees every node
+        for (int i = 0; i < 5; i++){
+            network.remove(10000 + i);
+        }
+        if (network.stats().frees != 5){
+            return false; 
+        }
+        network.resetStats();
+        if (network.stats().frees != 0){
+            return false; 
+        }
+#endif
+        return true; 
+    }
+
+    //Function: stats()
+    //Case: Edge case where the network is empty
+    //Expected result: no nodes, a height of -1 and only the object itself in use
+    bool statsEdge(){
+        cout << "TEST 27 RESULTS:" << endl; 
+
+        SatNet network;
+        SatStats result = network.stats();
+        return result.nodeCount == 0 && result.height == -1 && result.averageDepth == 0 &&
+               result.bytesUsed == (long long)sizeof(SatNet) && result.allocations == 0;
+    }
+
+    //Function: setLatencySampling(int sampleRate) and latency()
+    //Case: Normal case where every call is timed
+    //Expected result: every call lands in the histogram of its operation and the exports list them
+    bool latencyNormal(){
+        cout << "TEST 28 RESULTS:" << endl; 
+
+        SatNet network;
+        network.setLatencySampling(1);
+        for (int i = 0; i < 100; i++){
+            network.insert(Sat(10000 + i));
+        }
+        for (int i = 0; i < 100; i++){
+            network.findSatellite(10000 + i);
+        }
+        SatNet copy;
+        copy.setLatencySampling(1);
+        copy = network;
+        copy.clear();
+
+        const LatencyRecorder& recorder = network.latency();
+        if (recorder.histogram(OP_INSERT).getCount() != 100 || recorder.histogram(OP_FIND).getCount() != 100 ||
+            recorder.histogram(OP_REMOVE).getCount() != 0){
+            return false; 
+        }
+        if (copy.latency().histogram(OP_ASSIGN).getCount() != 1 || copy.latency().histogram(OP_CLEAR).getCount() != 1){
+            return false; 
+        }
+
+        // the percentiles never decrease and never pass the largest value
+        const LatencyHistogram& inserts = recorder.histogram(OP_INSERT);
+        if (inserts.percentile(50) > inserts.percentile(99) || inserts.percentile(99.9) > inserts.getMax()){
+            return false; 
+        }
+
+        string prometheus = recorder.toPrometheus();
+        if (prometheus.find("satnet_operation_latency_seconds_count{op=\"insert\"} 100") == string::npos ||
+            prometheus.find("satnet_operation_latency_seconds_bucket{op=\"findSatellite\",le=\"+Inf\"} 100") == string::npos ||
+            prometheus.find("satnet_operation_latency_seconds_bucket{op=\"insert\",le=\"1.073741823\"} ") == string::npos){
+            return false; 
+        }
+        return recorder.toText().find("findSatellite") != string::npos;
+    }
+
+    //Function: setLatencySampling(int sampleRate) and LatencyHistogram
+    //Case: Edge case where the timing is off or sampled, and known values are recorded
+    //Expected result: nothing or every 10th call is recorded, the percentiles are within a bucket width and the counts are exact at bucket edges
+    bool latencyEdge(){
+        cout << "TEST 29 RESULTS:" << endl; 
+
+        SatNet network;
+        for (int i = 0; i < 100; i++){
+            network.insert(Sat(10000 + i));
+        }
+        if (network.latency().histogram(OP_INSERT).getCount() != 0){
+            return false; 
+        }
+
+        network.setLatencySampling(10);
+        for (int i = 0; i < 100; i++){
+            network.setState(10000 + i, DECAYING);
+        }
+        if (network.latency().histogram(OP_SETSTATE).getCount() != 10){
+            return false; 
+        }
+
+        // 1..100000 ns, a bucket is at most 1/16 of its values wide
+        LatencyHistogram histogram;
+        for (uint64_t ns = 1; ns <= 100000; ns++){
+            histogram.record(ns);
+        }
+        double p50 = histogram.percentile(50);
+        double p99 = histogram.percentile(99);
+        if (fabs(p50 - 50000) > 50000 / 16.0 || fabs(p99 - 99000) > 99000 / 16.0 || histogram.getMax() != 100000){
+            return false; 
+        }
+        // 2047 ends a bucket and is exact, 2500 is inside the bucket 2432..2559 which isn't counted
+        return histogram.countAtMost(15) == 15 && histogram.countAtMost(2047) == 2047 && histogram.countAtMost(2500) == 2431 &&
+               histogram.countAtMost(100000) == 100000 && histogram.countAtMost(99999) <= 100000;
+    }
+
+    //Function: WorkloadMix::parse, TraceWriter, TraceReader and replayTrace(SatNet& network, const vector<TraceOp>& ops)
+    //Case: Normal case where a generated workload goes through a trace file from a parsed mix
+    //Expected result: the trace reads back unchanged and replaying it builds the same tree, bad mixes are refused
+    bool traceNormal(){
+        cout << "TEST 30 RESULTS:" << endl; 
+
+        const string fileName = "trace_test.bin";
+        WorkloadMix mix;
+        // bad mixes are refused and leave the mix as it was
+        if (mix.parse("50,30,10,9") || mix.parse("50,30,10,9,1,1") || mix.parse("50,x,10,9,1") || mix.parse("0,0,0,0,0") ||
+            mix.parse("99999999999999999999,1,1,1,1") || mix.parse("100000001,1,1,1,1") || mix.toString() != "50,30,10,9,1" ||
+            !mix.parse("100000000,100000000,100000000,100000000,100000000") || !mix.parse("50,30,10,9,1")){
+            return false; 
+        }
+        Workload workload(mix, 500);
+        vector<TraceOp> ops;
+        workload.load(ops);
+        workload.generate(3000, ops);
+
+        if (!writeTrace(fileName, ops)){
+            return false; 
+        }
+        vector<TraceOp> readBack;
+        bool read = readTrace(fileName, readBack);
+        std::remove(fileName.c_str());
+        if (!read || readBack.size() != ops.size() || !equal(ops.begin(), ops.end(), readBack.begin())){
+            return false; 
+        }
+
+        // the same operations give the same tree
+        SatNet network1(MINID, workload.maxID());
+        SatNet network2(MINID, workload.maxID());
+        replayTrace(network1, ops);
+        replayTrace(network2, readBack);
+        if (network1.m_root == nullptr || !isEqual(network1.m_root, network2.m_root)){
+            return false; 
+        }
+        return bstChecker(network2.m_root) && balanceChecker(network2.m_root);
+    }
+
+    //Function: recordTrace(TraceWriter* writer)
+    //Case: Edge case where calls on a live network, including invalid ids, are recorded
+    //Expected result: replaying the recording on an empty network gives the same tree
+    bool traceEdge(){
+        cout << "TEST 31 RESULTS:" << endl; 
+
+        const string fileName = "trace_test.bin";
+        SatNet network;
+        TraceWriter writer;
+        if (!writer.open(fileName, network.getMinID(), network.getMaxID())){
+            return false; 
+        }
+        network.recordTrace(&writer);
+        for (int i = 0; i < 50; i++){
+            network.insert(Sat(99999 - i * 37, static_cast<ALT>(i % 4), static_cast<INCLIN>(i % 3), i % 5 == 0 ? DEORBITED : ACTIVE));
+        }
+        network.insert(Sat(5));
+        network.findSatellite(99999);
+        network.setState(99999 - 37, DEORBITED);
+        network.remove(99999 - 74);
+        network.removeDeorbited();
+        network.recordTrace(nullptr);
+        // not recorded
+        network.findSatellite(99999);
+        network.setState(10001, ACTIVE);
+        writer.close();
+
+        vector<TraceOp> ops;
+        SatID minID = 0;
+        SatID maxID = 0;
+        bool read = readTrace(fileName, ops, minID, maxID);
+        std::remove(fileName.c_str());
+        if (!read || ops.size() != 55 || ops[50].id != 5 || ops[54].op != T_REMOVEDEORBITED || minID != MINID || maxID != MAXID){
+            return false; 
+        }
+        // the recorded range rejects the insert of 5 again
+        SatNet replayed(minID, maxID);
+        replayTrace(replayed, ops);
+        if (!isEqual(network.m_root, replayed.m_root)){
+            return false; 
+        }
+        // ids more than 2^63 apart, the deltas wrap around
+        vector<TraceOp> extremes(4);
+        extremes[0].id = INT64_MIN;
+        extremes[1].id = INT64_MAX;
+        extremes[2].id = INT64_MIN;
+        extremes[3].id = -1;
+        vector<TraceOp> readBack;
+        read = writeTrace(fileName, extremes) && readTrace(fileName, readBack);
+        std::remove(fileName.c_str());
+        return read && readBack.size() == 4 && equal(extremes.begin(), extremes.end(), readBack.begin());
+    }
+
+    //Function: setLazyRemove(bool lazy, double compactFraction) and remove(SatID id)
+    //Case: Normal case where removals leave tombstones until the compaction threshold
+    //Expected result: tombstones are invisible to lookups and counts, and the tree is rebuilt once there are too many
+    bool lazyRemoveNormal(){
+        cout << "TEST 32 RESULTS:" << endl; 
+
+        SatNet network;
+        network.setLazyRemove(true, 0.5);
+        for (int i = 0; i < 100; i++){
+            network.insert(Sat(10000 + i, MI208, static_cast<INCLIN>(i % 2)));
+        }
+        string before = out(network.m_root);
+
+        // remove the first 40, the tree keeps its shape
+        for (int i = 0; i < 40; i++){
+            network.remove(10000 + i);
+        }
+        if (network.getTombstones() != 40 || out(network.m_root) != before){
+            return false; 
+        }
+        if (network.findSatellite(10000) || network.setState(10001, DECAYING) || !network.findSatellite(10040)){
+            return false; 
+        }
+        if (network.countSatellites(I48) != 30 || network.countSatellites(I53) != 30){
+            return false; 
+        }
+
+        // a removed id can come back with new data
+        network.insert(Sat(10005, MI350, I97));
+        if (!network.findSatellite(10005) || network.getTombstones() != 39 || network.countSatellites(I97) != 1){
+            return false; 
+        }
+
+        // 51 of 100 nodes are tombstones now, past the fraction so the tree is rebuilt
+        for (int i = 40; i < 52; i++){
+            network.remove(10000 + i);
+        }
+        SatStats result = network.stats();
+        if (network.getTombstones() != 0 || result.nodeCount != 49 || !network.findSatellite(10005)){
+            return false; 
+        }
+        return bstChecker(network.m_root) && balanceChecker(network.m_root);
+    }
+
+    //Function: purgeTombstones() and removeDeorbited()
+    //Case: Edge case where tombstones are purged on demand, by removeDeorbited and by turning lazy removal off
+    //Expected result: the tombstones are freed and the tree is a balanced BST of the live nodes
+    bool lazyRemoveEdge(){
+        cout << "TEST 33 RESULTS:" << endl; 
+
+        SatNet network;
+        network.setLazyRemove(true, 0.9);
+        for (int i = 0; i < 64; i++){
+            network.insert(Sat(10000 + i, MI208, I48, i % 4 == 0 ? DEORBITED : ACTIVE));
+        }
+        // the 16 deorbited satellites become tombstones
+        network.removeDeorbited();
+        if (network.getTombstones() != 16 || network.findSatellite(10000) || network.countSatellites(I48) != 48){
+            return false; 
+        }
+        network.purgeTombstones();
+        if (network.getTombstones() != 0 || network.stats().nodeCount != 48 || !balanceChecker(network.m_root)){
+            return false; 
+        }
+        // removing twice or removing a missing id leaves one tombstone
+        network.remove(10001);
+        network.remove(10001);
+        network.remove(20000);
+        if (network.getTombstones() != 1){
+            return false; 
+        }
+        // turning lazy removal off purges
+        network.setLazyRemove(false);
+        if (network.getTombstones() != 0 || network.stats().nodeCount != 47 || network.findSatellite(10001)){
+            return false; 
+        }
+        // purging an empty network does nothing
+        SatNet empty;
+        empty.purgeTombstones();
+        return empty.m_root == nullptr && bstChecker(network.m_root) && balanceChecker(network.m_root);
+    }
+
+    //Function: unionWith(const SatNet& rhs) and difference(const SatNet& rhs)
+    //Case: Normal case with two overlapping networks
+    //Expected result: the union holds every id with rhs's data on overlaps, the difference drops rhs's ids
+    bool unionDifferenceNormal(){
+        cout << "TEST 34 RESULTS:" << endl; 
+
+        SatNet evens;
+        SatNet threes;
+        for (int i = 0; i < 3000; i += 2){
+            evens.insert(Sat(10000 + i, MI208, I48));
+        }
+        for (int i = 0; i < 3000; i += 3){
+            threes.insert(Sat(10000 + i, MI350, I97, DECAYING));
+        }
+        string threesBefore = out(threes.m_root);
+
+        SatNet merged;
+        merged = evens;
+        merged.unionWith(threes);
+        if (!bstChecker(merged.m_root) || !balanceChecker(merged.m_root) || out(threes.m_root) != threesBefore){
+            return false; 
+        }
+        // 1500 evens, 1000 threes and 500 ids in both
+        if (merged.stats().nodeCount != 2000 || merged.m_nodes != 2000 || merged.countSatellites(I97) != 1000){
+            return false; 
+        }
+        for (int i = 0; i < 3000; i++){
+            if (merged.findSatellite(10000 + i) != (i % 2 == 0 || i % 3 == 0)){
+                return false; 
+            }
+        }
+
+        // evens without the multiples of 3 leaves the ids 2 and 4 mod 6
+        evens.difference(threes);
+        if (!bstChecker(evens.m_root) || !balanceChecker(evens.m_root) || evens.m_nodes != 1000 || evens.stats().nodeCount != 1000){
+            return false; 
+        }
+        for (int i = 0; i < 3000; i++){
+            if (evens.findSatellite(10000 + i) != (i % 6 == 2 || i % 6 == 4)){
+                return false; 
+            }
+        }
+        return true; 
+    }
+
+    //Function: join(SatNet& rhs), split(SatID id, SatNet& right) and extractRange(SatID low, SatID high, SatNet& dest)
+    //Case: Edge case with empty networks, ranges at the ends and disjoint networks
+    //Expected result: satellites are moved between the networks and every tree stays a balanced BST
+    bool joinSplitEdge(){
+        cout << "TEST 35 RESULTS:" << endl; 
+
+        SatNet network;
+        for (int i = 0; i < 1000; i++){
+            network.insert(Sat(10000 + i));
+        }
+        SatNet range;
+        network.extractRange(10100, 10199, range);
+        if (range.m_nodes != 100 || network.m_nodes != 900 || range.findSatellite(10099) || !range.findSatellite(10100) ||
+            !range.findSatellite(10199) || network.findSatellite(10150) || !network.findSatellite(10200)){
+            return false; 
+        }
+        if (!balanceChecker(range.m_root) || !balanceChecker(network.m_root) || !bstChecker(range.m_root) || !bstChecker(network.m_root)){
+            return false; 
+        }
+
+        // splitting past the largest id moves nothing, splitting at the smallest moves everything
+        SatNet right;
+        network.split(20000, right);
+        if (right.m_root != nullptr || network.m_nodes != 900){
+            return false; 
+        }
+        network.split(10000, right);
+        if (network.m_root != nullptr || right.m_nodes != 900 || !balanceChecker(right.m_root)){
+            return false; 
+        }
+
+        // the range goes back in front of the rest by concatenation, then an empty network is joined
+        SatNet high;
+        right.split(10500, high);
+        range.join(high);
+        range.join(right);
+        SatNet empty;
+        range.join(empty);
+        if (high.m_root != nullptr || right.m_root != nullptr || range.m_nodes != 1000 || range.stats().nodeCount != 1000){
+            return false; 
+        }
+        return bstChecker(range.m_root) && balanceChecker(range.m_root) && range.findSatellite(10000) && range.findSatellite(10999);
+    }
+
+    //Function: unionWith(const SatNet& rhs, TaskPool& pool) and difference(const SatNet& rhs, TaskPool& pool)
+    //Case: Normal case with networks large enough to be split over several tasks
+    //Expected result: the parallel operations build exactly the trees of the sequential ones
+    bool parallelSetNormal(){
+        cout << "TEST 36 RESULTS:" << endl; 
+
+        SatNet evens;
+        SatNet threes;
+        for (int i = 0; i < 60000; i += 2){
+            evens.insert(Sat(10000 + i, MI208, I48));
+        }
+        for (int i = 0; i < 60000; i += 3){
+            threes.insert(Sat(10000 + i, MI350, I97, DECAYING));
+        }
+        TaskPool pool(4);
+
+        SatNet sequential;
+        SatNet parallel;
+        sequential = evens;
+        parallel = evens;
+        sequential.unionWith(threes);
+        parallel.unionWith(threes, pool);
+        if (out(sequential.m_root) != out(parallel.m_root) || parallel.m_nodes != 40000 || parallel.stats().nodeCount != 40000){
+            return false; 
+        }
+        if (!bstChecker(parallel.m_root) || !balanceChecker(parallel.m_root)){
+            return false; 
+        }
+
+        sequential = evens;
+        parallel = evens;
+        sequential.difference(threes);
+        parallel.difference(threes, pool);
+        if (out(sequential.m_root) != out(parallel.m_root) || parallel.m_nodes != 20000 || parallel.stats().nodeCount != 20000){
+            return false; 
+        }
+        return bstChecker(parallel.m_root) && balanceChecker(parallel.m_root);
+    }
+
+    //Function: insert(const Sat& satellite), remove(SatID id) and setState(SatHandle handle, STATE state)
+    //Case: Normal case where a third of the satellites are removed, many of them with two children
+    //Expected result: every remaining handle still points at its own satellite in the tree
+    bool handleNormal(){
+        cout << "TEST 37 RESULTS:" << endl; 
+
+        SatNet network;
+        SatHandle handles[3000];
+        for (int i = 0; i < 3000; i++){
+            handles[i] = network.insert(Sat(10000 + i, MI208, I48, ACTIVE));
+            if (handles[i] == nullptr || handles[i]->getID() != 10000 + i){
+                return false; 
+            }
+        }
+        for (int i = 0; i < 3000; i += 3){
+            network.remove(10000 + i);
+        }
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root)){
+            return false; 
+        }
+        for (int i = 0; i < 3000; i++){
+            if (i % 3 == 0){
+                continue;
+            }
+            // the handle must be the node the tree reaches for its id
+            Sat* node = network.m_root;
+            while (node != nullptr && node->getID() != 10000 + i){
+                node = (10000 + i < node->getID()) ? node->m_left : node->m_right;
+            }
+            if (node != handles[i] || !network.setState(handles[i], DECAYING) || node->getState() != DECAYING){
+                return false; 
+            }
+        }
+        return true; 
+    }
+
+    //Function: insert(const Sat& satellite) and setState(SatHandle handle, STATE state)
+    //Case: Edge case with duplicate and invalid ids, a null handle and a lazily removed satellite
+    //Expected result: no handle for failed inserts, setState fails on null and removed handles and a revived satellite keeps its handle
+    bool handleEdge(){
+        cout << "TEST 38 RESULTS:" << endl; 
+
+        SatNet network;
+        SatHandle handle = network.insert(Sat(20000));
+        if (handle == nullptr || network.insert(Sat(20000)) != nullptr || network.insert(Sat(MAXID + 1)) != nullptr){
+            return false; 
+        }
+        if (network.setState(nullptr, DEORBITED)){
+            return false; 
+        }
+        network.setLazyRemove(true, 1.0);
+        network.insert(Sat(20001));
+        network.remove(20000);
+        if (network.setState(handle, DEORBITED) || handle->getState() != ACTIVE){
+            return false; 
+        }
+        // inserting the id again brings the tombstone back with the same address
+        if (network.insert(Sat(20000, MI350)) != handle || !network.setState(handle, DEORBITED)){
+            return false; 
+        }
+        return handle->getAlt() == MI350 && handle->getState() == DEORBITED; 
+    }
+
+    //Function: rank(SatID id), select(int k) and size()
+    //Case: Normal case after random inserts, removes, lazy removes and removeDeorbited
+    //Expected result: the subtree sizes are correct and rank and select match a sorted list of the ids
+    bool orderStatisticNormal(){
+        cout << "TEST 39 RESULTS:" << endl; 
+
+        Random idGen(MINID, MAXID);
+        Random stateGen(0, 3);
+        SatNet network;
+        for (int i = 0; i < 3000; i++){
+            network.insert(Sat(idGen.getRandNum(), MI208, I48, stateGen.getRandNum() == 0 ? DEORBITED : ACTIVE));
+        }
+        for (int i = 0; i < 500; i++){
+            network.remove(idGen.getRandNum());
+        }
+        network.removeDeorbited();
+        network.setLazyRemove(true, 0.5);
+        for (int i = 0; i < 500; i++){
+            network.remove(idGen.getRandNum());
+        }
+        if (!sizeChecker(network.m_root) || network.size() != network.m_root->getSize() || network.getTombstones() == 0){
+            return false; 
+        }
+
+        // the live ids in ascending order
+        vector<SatID> ids;
+        for (int i = 0; i < network.size(); i++){
+            SatHandle handle = network.select(i);
+            if (handle == nullptr || handle->isDeleted() || (i > 0 && handle->getID() <= ids.back())){
+                return false; 
+            }
+            ids.push_back(handle->getID());
+        }
+        for (int i = 0; i < (int)ids.size(); i++){
+            if (network.rank(ids[i]) != i || network.rank(ids[i] + 1) != i + 1 || !network.findSatellite(ids[i])){
+                return false; 
+            }
+        }
+        return network.percentile(50)->getID() == ids[(ids.size() + 1) / 2 - 1];
+    }
+
+    //Function: rank(SatID id), select(int k) and percentile(double p)
+    //Case: Edge case with an empty network, out of range ranks and the ends of the percentiles
+    //Expected result: nullptr for missing satellites, 0 and size() for ids outside the network
+    bool orderStatisticEdge(){
+        cout << "TEST 40 RESULTS:" << endl; 
+
+        SatNet network;
+        if (network.size() != 0 || network.select(0) != nullptr || network.percentile(50) != nullptr || network.rank(MAXID) != 0){
+            return false; 
+        }
+        for (int i = 0; i < 100; i++){
+            network.insert(Sat(20000 + i * 10));
+        }
+        if (network.select(-1) != nullptr || network.select(100) != nullptr || network.select(99)->getID() != 20990){
+            return false; 
+        }
+        if (network.rank(MINID) != 0 || network.rank(MAXID) != 100 || network.rank(20005) != 1){
+            return false; 
+        }
+        return network.percentile(0)->getID() == 20000 && network.percentile(100)->getID() == 20990 &&
+               network.percentile(-5)->getID() == 20000 && network.percentile(1)->getID() == 20000;
+    }
+
+    //Function: AsyncSatNet insert, remove and setState with futures
+    //Case: Normal case with four producer threads enqueueing at the same time, a reader and a trace being recorded
+    //Expected result: every command is applied and traced once, the reads aren't traced and the network is a balanced BST
+    bool asyncNormal(){
+        cout << "TEST 41 RESULTS:" << endl; 
+
+        const string fileName = "trace_test.bin";
+        SatNet network;
+        TraceWriter trace;
+        if (!trace.open(fileName, network.getMinID(), network.getMaxID())){
+            return false; 
+        }
+        network.recordTrace(&trace);
+        atomic<int> failures(0);
+        atomic<bool> done(false);
+        atomic<long long> reads(0);
+        {
+            AsyncSatNet async(network, 256);
+            // a reader runs next to the producers and never sees half a batch or a broken tree
+            thread reader([&]{
+                while (!done){
+                    async.findSatellite(10000 + reads % 4000);
+                    async.read([&](const SatNet& view){
+                        if (view.size() != view.stats().nodeCount) failures++;
+                    });
+                    reads++;
+                }
+            });
+            vector<thread> producers;
+            for (int p = 0; p < 4; p++){
+                producers.push_back(thread([&async, &failures, p]{
+                    // each producer inserts its own 1000 ids and removes every other one again
+                    vector<future<bool>> results;
+                    for (int i = 0; i < 1000; i++){
+                        results.push_back(async.insert(Sat(10000 + i * 4 + p)));
+                    }
+                    for (int i = 0; i < 1000; i += 2){
+                        results.push_back(async.remove(10000 + i * 4 + p));
+                    }
+                    for (size_t i = 0; i < results.size(); i++){
+                        if (!results[i].get()) failures++;
+                    }
+                }));
+            }
+            for (size_t p = 0; p < producers.size(); p++){
+                producers[p].join();
+            }
+            async.flush();
+            done = true;
+            reader.join();
+            if (async.size() != 2000 || async.getApplied() != 6000 || async.findSatellite(10000) || !async.findSatellite(10004 + 3)){
+                return false; 
+            }
+        }
+        // only the commands are traced, the reads aren't
+        bool traced = trace.close() && trace.getCount() == 6000 && network.getTrace() == &trace;
+        std::remove(fileName.c_str());
+        return traced && failures == 0 && reads > 0 && network.size() == 2000 && bstChecker(network.m_root) &&
+               balanceChecker(network.m_root);
+    }
+
+    //Function: AsyncSatNet callbacks, flush and the destructor
+    //Case: Edge case with failing commands, a ring of 2 slots and commands left in the ring at destruction
+    //Expected result: failing commands report false, a full ring only slows producers down and nothing is lost
+    bool asyncEdge(){
+        cout << "TEST 42 RESULTS:" << endl; 
+
+        SatNet network;
+        atomic<int> trueResults(0);
+        atomic<int> falseResults(0);
+        {
+            AsyncSatNet async(network, 2);
+            function<void(bool)> count = [&](bool result){(result ? trueResults : falseResults)++;};
+            async.insert(Sat(20000), count);
+            async.insert(Sat(20000), count);        // duplicate
+            async.insert(Sat(MAXID + 1), count);    // invalid
+            async.remove(30000, count);             // missing
+            async.setState(30000, DECAYING, count); // missing
+            async.setState(20000, DEORBITED, count);
+            async.flush();
+            if (trueResults != 2 || falseResults != 4){
+                return false; 
+            }
+            // a setState and remove of the same id in one batch keep their order
+            async.setState(20000, ACTIVE, count);
+            async.remove(20000, count);
+            for (int i = 0; i < 500; i++){
+                async.insert(Sat(40000 + i), count);
+            }
+        }
+        return trueResults == 504 && network.size() == 500 && !network.findSatellite(20000) && balanceChecker(network.m_root);
+    }
+
+    //Function: clear(), operator= and the destructor with setBackgroundClear(true)
+    //Case: Normal case with large networks
+    //Expected result: the networks are empty right away and the reclaimer frees every node later
+    bool backgroundClearNormal(){
+        cout << "TEST 43 RESULTS:" << endl; 
+
+        Reclaimer& reclaimer = Reclaimer::instance();
+        reclaimer.drain();
+        long long freed = reclaimer.getFreed();
+        long long trees = reclaimer.getTrees();
+        {
+            SatNet network;
+            network.setBackgroundClear(true);
+            for (int i = 0; i < 50000; i++){
+                network.insert(Sat(10000 + i));
+            }
+            SatNet copy;
+            copy.setBackgroundClear(true);
+            copy = network;
+            network.clear();
+            if (network.m_root != nullptr || network.size() != 0 || network.m_nodes != 0){
+                return false; 
+            }
+            // the network can be used again while its old tree is being freed
+            network.insert(Sat(20000));
+            copy = network;
+            if (copy.size() != 1 || !copy.findSatellite(20000)){
+                return false; 
+            }
+        }
+        // the clear, the old tree of the copy replaced by operator= and the two destructors
+        reclaimer.drain();
+        return reclaimer.getPending() == 0 && reclaimer.getFreed() - freed == 100002 && reclaimer.getTrees() - trees == 4;
+    }
+
+    //Function: clear() with and without setBackgroundClear(true)
+    //Case: Edge case with an empty network and background clearing turned off
+    //Expected result: nothing is handed to the reclaimer
+    bool backgroundClearEdge(){
+        cout << "TEST 44 RESULTS:" << endl; 
+
+        Reclaimer& reclaimer = Reclaimer::instance();
+        reclaimer.drain();
+        long long trees = reclaimer.getTrees();
+        SatNet empty;
+        empty.setBackgroundClear(true);
+        empty.clear();
+        SatNet network;
+        for (int i = 0; i < 1000; i++){
+            network.insert(Sat(10000 + i));
+        }
+        network.clear();
+        reclaimer.drain();
+        return reclaimer.getTrees() == trees && network.m_root == nullptr && network.m_nodes == 0;
+    }
+
+    //Function: recordChanges(ChangeLog* log), writeBatch, readBatch and Replica::apply
+    //Case: Normal case with random inserts, removes, state changes and removeDeorbited sent over a pipe
+    //Expected result: the replica holds the same satellites as the primary after every batch
+    bool changeStreamNormal(){
+        cout << "TEST 45 RESULTS:" << endl; 
+
+        Random idGen(MINID, MINID + 5000);
+        Random opGen(0, 99);
+        SatNet primary;
+        ChangeLog log;
+        primary.recordChanges(&log);
+        Replica replica;
+        int pipeEnds[2];
+        if (pipe(pipeEnds) != 0){
+            return false; 
+        }
+        bool same = true;
+        for (int round = 0; round < 20 && same; round++){
+            // the second half runs with lazy removal, tombstones must not reach the replica
+            primary.setLazyRemove(round >= 10);
+            for (int i = 0; i < 500; i++){
+                int op = opGen.getRandNum();
+                SatID id = idGen.getRandNum();
+                if (op < 50) primary.insert(Sat(id, static_cast<ALT>(op % 4), static_cast<INCLIN>(op / 4 % 4)));
+                else if (op < 75) primary.remove(id);
+                else if (op < 99) primary.setState(id, op % 2 ? DEORBITED : DECAYING);
+                else primary.removeDeorbited();
+            }
+            ChangeBatch batch;
+            ChangeBatch received;
+            if (!log.since(replica.getSeq(), batch) || !writeBatch(pipeEnds[1], batch) ||
+                !readBatch(pipeEnds[0], received) || !replica.apply(received)){
+                same = false;
+            }
+            same = same && replica.getSeq() == log.getLastSeq() && sameSatellites(primary, replica.getNetwork());
+        }
+        close(pipeEnds[0]);
+        close(pipeEnds[1]);
+        return same && balanceChecker(replica.getNetwork().m_root); 
+    }
+
+    //Function: ChangeLog::since, Replica::catchUp and makeSnapshot
+    //Case: Edge case where the replica falls behind the log, small and large bulk operations and a batch with a gap
+    //Expected result: catchUp follows the small bulk operations and reports that a snapshot is needed after the others, the snapshot brings the replica back in sync
+    bool changeStreamEdge(){
+        cout << "TEST 46 RESULTS:" << endl; 
+
+        SatNet primary;
+        ChangeLog log(100);
+        primary.recordChanges(&log);
+        Replica replica;
+        for (int i = 0; i < 50; i++){
+            primary.insert(Sat(10000 + i));
+        }
+        if (!replica.catchUp(log) || replica.getSeq() != 50 || !sameSatellites(primary, replica.getNetwork())){
+            return false; 
+        }
+        // 150 more changes, the oldest 50 of them are gone from the log
+        for (int i = 0; i < 150; i++){
+            primary.setState(10000 + i % 50, DECAYING);
+        }
+        if (replica.catchUp(log) || log.getFirstSeq() != 101){
+            return false; 
+        }
+        if (!replica.apply(makeSnapshot(primary, log)) || replica.getSeq() != 200 || !replica.catchUp(log)){
+            return false; 
+        }
+        // a small union and an extractRange are logged change by change and the replica follows them
+        SatNet other;
+        other.insert(Sat(20000));
+        other.insert(Sat(10001, MI208, I48, DEORBITED));
+        primary.unionWith(other);
+        SatNet moved;
+        primary.extractRange(10040, 10044, moved);
+        primary.join(moved);
+        if (!replica.catchUp(log) || !sameSatellites(primary, replica.getNetwork())){
+            return false; 
+        }
+        // a union larger than MAX_LOGGED_BULK isn't, so a replica that was up to date needs a snapshot
+        SatNet large;
+        for (int i = 0; i <= MAX_LOGGED_BULK; i++){
+            large.insert(Sat(30000 + i));
+        }
+        primary.unionWith(large);
+        ChangeBatch batch;
+        if (replica.catchUp(log) || log.since(log.getLastSeq() - 1, batch)){
+            return false; 
+        }
+        replica.apply(makeSnapshot(primary, log));
+        // a batch that doesn't start right after the replica's sequence number is refused
+        primary.remove(20000);
+        primary.remove(10000);
+        log.since(log.getLastSeq() - 1, batch);
+        if (replica.apply(batch) || !replica.catchUp(log)){
+            return false; 
+        }
+        // a truncated batch doesn't decode
+        vector<unsigned char> data;
+        encodeBatch(batch, data);
+        data.pop_back();
+        ChangeBatch broken;
+        return !decodeBatch(data, broken) && sameSatellites(primary, replica.getNetwork()) &&
+               replica.getNetwork().size() == 49 + MAX_LOGGED_BULK + 1;
+    }
+
+    //Function: SatNet::findSatellites
+    //Case: Normal case of a sorted batch with duplicates, tombstones and ids that were never inserted
+    //Expected result: every answer matches findSatellite for the same id
+    bool batchFindNormal(){
+        cout << "TEST 47 RESULTS:" << endl; 
+
+        Random idGen(MINID, MINID + 3000);
+        SatNet network;
+        network.setLazyRemove(true);
+        for (int i = 0; i < 1500; i++){
+            network.insert(Sat(idGen.getRandNum()));
+        }
+        for (int i = 0; i < 500; i++){
+            network.remove(idGen.getRandNum());
+        }
+        vector<SatID> ids;
+        for (int i = 0; i < 2000; i++){
+            ids.push_back(idGen.getRandNum());
+        }
+        sort(ids.begin(), ids.end());
+        vector<bool> found;
+        network.findSatellites(ids, found);
+        if (found.size() != ids.size()){
+            return false; 
+        }
+        for (size_t i = 0; i < ids.size(); i++){
+            if (found[i] != network.findSatellite(ids[i])){
+                return false; 
+            }
+        }
+        return true; 
+    }
+
+    //Function: SatNet::findSatellites
+    //Case: Edge case of an empty batch, an empty network and ids outside the network's range
+    //Expected result: an empty batch gives no answers, every other id is reported missing
+    bool batchFindEdge(){
+        cout << "TEST 48 RESULTS:" << endl; 
+
+        SatNet network;
+        vector<SatID> ids;
+        vector<bool> found(3, true);
+        network.findSatellites(ids, found);
+        if (!found.empty()){
+            return false; 
+        }
+        ids.push_back(MINID - 1);
+        ids.push_back(MINID);
+        ids.push_back(MINID);
+        ids.push_back(MAXID + 1);
+        network.findSatellites(ids, found);
+        if (found.size() != 4 || found[0] || found[1] || found[2] || found[3]){
+            return false; 
+        }
+        network.insert(Sat(MINID));
+        network.findSatellites(ids, found);
+        return !found[0] && found[1] && found[2] && !found[3]; 
+    }
+
+    //Function: SatNet::nextSatellite, SatNet::prevSatellite and SatNet::getIDs
+    //Case: Normal case of inserts, eager and lazy removes, removeDeorbited and the bulk operations
+    //Expected result: the bitmap index answers exactly like a walk of the tree after every step
+    bool idIndexNormal(){
+        cout << "TEST 49 RESULTS:" << endl; 
+
+        Random idGen(MINID, MAXID);
+        Random opGen(0, 99);
+        SatNet network;
+        SatNet other;
+        bool same = true;
+        for (int round = 0; round < 12 && same; round++){
+            network.setLazyRemove(round % 3 == 1);
+            for (int i = 0; i < 2000; i++){
+                int op = opGen.getRandNum();
+                SatID id = idGen.getRandNum();
+                if (op < 60) network.insert(Sat(id, MI208, I48, op % 5 == 0 ? DEORBITED : ACTIVE));
+                else if (op < 90) network.remove(id);
+                else other.insert(Sat(id));
+            }
+            if (round % 4 == 0) network.removeDeorbited();
+            else if (round % 4 == 1) network.unionWith(other);
+            else if (round % 4 == 2) network.difference(other);
+            else {
+                SatNet right;
+                network.split(idGen.getRandNum(), right);
+                same = indexChecker(right);
+                network.join(right);
+                same = same && indexChecker(right);
+            }
+            same = same && indexChecker(network);
+        }
+        SatNet copy;
+        copy = network;
+        return same && indexChecker(copy) && network.m_index.isEnabled(); 
+    }
+
+    //Function: SatNet::nextSatellite, SatNet::prevSatellite and SatNet::getIDs
+    //Case: Edge case of an empty network, the ends of the id range and a range too wide to index
+    //Expected result: nothing is found in an empty network, the ends are found, the wide network uses the tree
+    bool idIndexEdge(){
+        cout << "TEST 50 RESULTS:" << endl; 
+
+        SatNet network;
+        SatID id = 0;
+        vector<SatID> ids;
+        network.getIDs(MINID, MAXID, ids);
+        if (network.nextSatellite(MINID - 5, id) || network.prevSatellite(MAXID + 5, id) || !ids.empty()){
+            return false; 
+        }
+        network.insert(Sat(MINID));
+        network.insert(Sat(MAXID));
+        if (!network.nextSatellite(INT64_MIN, id) || id != MINID || !network.nextSatellite(MINID, id) || id != MAXID ||
+            network.nextSatellite(MAXID, id) || !network.prevSatellite(INT64_MAX, id) || id != MAXID ||
+            !network.prevSatellite(MAXID, id) || id != MINID || network.prevSatellite(MINID, id)){
+            return false; 
+        }
+        network.getIDs(MINID, MINID, ids);
+        network.getIDs(MAXID, INT64_MAX, ids);
+        if (ids.size() != 2 || ids[0] != MINID || ids[1] != MAXID){
+            return false; 
+        }
+        // the whole 64-bit range is too wide for a bitmap
+        SatNet wide(INT64_MIN, INT64_MAX);
+        wide.insert(Sat(INT64_MIN));
+        wide.insert(Sat(-5));
+        wide.insert(Sat(INT64_MAX));
+        wide.setLazyRemove(true);
+        wide.insert(Sat(7));
+        wide.remove(7);
+        if (wide.m_index.isEnabled() || !wide.nextSatellite(-5, id) || id != INT64_MAX ||
+            !wide.prevSatellite(INT64_MAX, id) || id != -5 || wide.nextSatellite(INT64_MAX, id)){
+            return false; 
+        }
+        return indexChecker(wide) && indexChecker(network); 
+    }
+
+    //Function: SatNet::setLookupCache, SatNet::findSatellite and SatNet::setState
+    //Case: Normal case of a few hundred hot ids getting most of the lookups in a changing network
+    //Expected result: every answer matches a network without the cache and most lookups are cache hits
+    bool lookupCacheNormal(){
+        cout << "TEST 51 RESULTS:" << endl; 
+
+        // the generators share a seed, so the operation and the id come from one draw
+        Random draw(0, 999999);
+        SatNet cached;
+        SatNet plain;
+        cached.setLookupCache();
+        for (SatID id = MINID; id < MINID + 5000; id++){
+            cached.insert(Sat(id));
+            plain.insert(Sat(id));
+        }
+        for (int i = 0; i < 50000; i++){
+            int value = draw.getRandNum();
+            int op = value % 100;
+            // 80% of the operations are lookups of 300 hot ids, removes and inserts only touch cold ids
+            bool hot = op < 40 || (op >= 50 && op < 90);
+            SatID id = hot ? MINID + (value / 100) % 300 : MINID + 300 + (value / 100) % 9700;
+            if (op < 50){
+                if (cached.findSatellite(id) != plain.findSatellite(id)) return false; 
+            }
+            else if (op < 95){
+                STATE state = static_cast<STATE>(value % 3);
+                if (cached.setState(id, state) != plain.setState(id, state)) return false; 
+            }
+            else if (op < 98){
+                cached.remove(id);
+                plain.remove(id);
+            }
+            else {
+                cached.insert(Sat(id));
+                plain.insert(Sat(id));
+            }
+        }
+        double hitRate = cached.getCacheHitRate();
+        cached.resetStats();
+        return sameSatellites(cached, plain) && hitRate > 0.7 && cached.getCacheHits() == 0 && cached.getCacheHitRate() == 0; 
+    }
+
+    //Function: SatNet::setLookupCache
+    //Case: Edge case where cached satellites are removed by remove, removeDeorbited, clear, operator= and a difference
+    //Expected result: no stale node is ever returned, the cache can be resized and turned off
+    bool lookupCacheEdge(){
+        cout << "TEST 52 RESULTS:" << endl; 
+
+        SatNet network;
+        network.setLookupCache(3);
+        if (network.m_cache.getEntries() != 4 || network.getCacheHitRate() != 0){
+            return false; 
+        }
+        for (SatID id = MINID; id < MINID + 100; id++){
+            network.insert(Sat(id, MI208, I48, id % 2 ? DEORBITED : ACTIVE));
+            network.findSatellite(id);
+        }
+        network.remove(MINID + 99);
+        network.removeDeorbited();
+        if (network.findSatellite(MINID + 99) || network.findSatellite(MINID + 1) || network.setState(MINID + 97, ACTIVE) ||
+            !network.findSatellite(MINID + 98) || !network.setState(MINID + 98, DECAYING)){
+            return false; 
+        }
+        // a lazily removed satellite stays cached as a tombstone until it is brought back
+        network.setLazyRemove(true);
+        network.remove(MINID + 98);
+        if (network.findSatellite(MINID + 98) || network.setState(MINID + 98, ACTIVE)){
+            return false; 
+        }
+        network.insert(Sat(MINID + 98));
+        network.setLazyRemove(false);
+        SatNet other;
+        other.insert(Sat(MINID + 98));
+        network.difference(other);
+        if (network.findSatellite(MINID + 98) || !network.findSatellite(MINID)){
+            return false; 
+        }
+        SatNet copy;
+        copy.setLookupCache(16);
+        copy.findSatellite(MINID);
+        copy = network;
+        network.clear();
+        if (network.findSatellite(MINID) || !copy.findSatellite(MINID) || !copy.setState(MINID + 2, DECAYING)){
+            return false; 
+        }
+        // the cache can be turned off
+        copy.setLookupCache(0);
+        long long probes = copy.getCacheHits() + copy.getCacheMisses();
+        return copy.findSatellite(MINID) && !copy.m_cache.isEnabled() && copy.getCacheHits() + copy.getCacheMisses() == probes; 
+    }
+
+    //Function: SatNet::updateWhere
+    //Case: Normal case of moving every decaying satellite at 208 miles to deorbited, sequentially and on a pool
+    //Expected result: exactly the matching satellites change, both versions agree and a replica sees every change
+    bool updateWhereNormal(){
+        cout << "TEST 53 RESULTS:" << endl; 
+
+        Random draw(0, 999999);
+        SatNet network;
+        ChangeLog log;
+        network.recordChanges(&log);
+        for (int i = 0; i < 20000; i++){
+            int value = draw.getRandNum();
+            network.insert(Sat(MINID + value % 80000, static_cast<ALT>(value / 7 % 4), I48, static_cast<STATE>(value / 11 % 3)));
+        }
+        SatNet parallel;
+        parallel = network;
+        vector<Sat> before;
+        network.getSatellites(before);
+        auto decaying = [](const Sat& satellite){return satellite.getState() == DECAYING && satellite.getAlt() == MI208;};
+        int expected = 0;
+        for (size_t i = 0; i < before.size(); i++){
+            expected += decaying(before[i]);
+        }
+        Replica replica;
+        replica.catchUp(log);
+        TaskPool pool(4);
+        int changed = network.updateWhere(decaying, DEORBITED);
+        int changedParallel = parallel.updateWhere(decaying, DEORBITED, pool);
+        vector<Sat> after;
+        network.getSatellites(after);
+        for (size_t i = 0; i < after.size(); i++){
+            STATE state = decaying(before[i]) ? DEORBITED : before[i].getState();
+            if (after[i].getID() != before[i].getID() || after[i].getState() != state){
+                return false; 
+            }
+        }
+        return changed == expected && changedParallel == expected && expected > 0 && sameSatellites(network, parallel) &&
+               replica.catchUp(log) && sameSatellites(network, replica.getNetwork()) && network.updateWhere(decaying, ACTIVE) == 0; 
+    }
+
+    //Function: SatNet::removeWhere
+    //Case: Edge case of removing a few, most, all and none of the satellites, eagerly, lazily and on a pool
+    //Expected result: the tree stays a balanced BST with the right sizes and only the matches are gone
+    bool removeWhereEdge(){
+        cout << "TEST 54 RESULTS:" << endl; 
+
+        SatNet network;
+        for (SatID id = MINID; id < MINID + 4000; id++){
+            network.insert(Sat(id, static_cast<ALT>(id % 4)));
+        }
+        TaskPool pool(4);
+        // a few matches are removed one at a time, most of them with a rebuild
+        int few = network.removeWhere([](const Sat& satellite){return satellite.getID() % 500 == 0;});
+        int most = network.removeWhere([](const Sat& satellite){return satellite.getAlt() != MI350;}, pool);
+        if (few != 8 || most != 2992 || network.size() != 1000 || network.findSatellite(MINID + 1) || !network.findSatellite(MINID + 3)){
+            return false; 
+        }
+        if (!bstChecker(network.m_root) || !balanceChecker(network.m_root) || !sizeChecker(network.m_root) || !indexChecker(network)){
+            return false; 
+        }
+        // lazily the matches become tombstones until there are too many
+        network.setLazyRemove(true);
+        int lazy = network.removeWhere([](const Sat& satellite){return satellite.getID() < MINID + 100;});
+        if (lazy != 25 || network.getTombstones() != 25 || network.findSatellite(MINID + 3) ||
+            network.removeWhere([](const Sat&){return false;}) != 0){
+            return false; 
+        }
+        int all = network.removeWhere([](const Sat&){return true;}, pool);
+        SatNet empty;
+        return all == 975 && network.size() == 0 && network.m_root == nullptr &&
+               empty.removeWhere([](const Sat&){return true;}) == 0 && empty.updateWhere([](const Sat&){return true;}, DEORBITED) == 0; 
+    }
+
+    //Function: SatNet::listShell and SatNet::countShell
+    //Case: Normal case of inserts, eager and lazy removes, revived tombstones, removeDeorbited, removeWhere and the bulk operations
+    //Expected result: every shell lists and counts the same satellites as a filter of the whole tree after every step
+    bool shellIndexNormal(){
+        cout << "TEST 55 RESULTS:" << endl; 
+
+        // the generators share a seed, so the operation and the attributes come from one draw
+        Random draw(0, 999999);
+        SatNet network;
+        SatNet other;
+        bool same = true;
+        for (int round = 0; round < 12 && same; round++){
+            network.setLazyRemove(round % 3 == 1);
+            for (int i = 0; i < 2000; i++){
+                int value = draw.getRandNum();
+                SatID id = MINID + value % 20000;
+                ALT alt = static_cast<ALT>(value / 7 % 4);
+                INCLIN inclin = static_cast<INCLIN>(value / 31 % 4);
+                int op = value / 101 % 100;
+                if (op < 60) network.insert(Sat(id, alt, inclin, op % 5 == 0 ? DEORBITED : ACTIVE));
+                else if (op < 90) network.remove(id);
+                else other.insert(Sat(id, alt, inclin));
+            }
+            if (round % 5 == 0) network.removeDeorbited();
+            else if (round % 5 == 1) network.unionWith(other);
+            else if (round % 5 == 2) network.difference(other);
+            else if (round % 5 == 3) network.removeWhere([](const Sat& satellite){return satellite.getInclin() == I70 && satellite.getID() % 3 == 0;});
+            else {
+                SatNet right;
+                network.split(MINID + draw.getRandNum() % 20000, right);
+                same = shellChecker(right);
+                network.join(right);
+            }
+            same = same && shellChecker(network);
+        }
+        SatNet copy;
+        copy = network;
+        return same && shellChecker(copy) && network.countShell(MI340, I53) > 0; 
+    }
+
+    //Function: SatNet::listShell and SatNet::countShell
+    //Case: Edge case of empty shells, ranges of ids within a shell and a range too wide for the id index
+    //Expected result: empty shells list nothing, a range only lists the shell's ids inside it and the wide network is indexed too
+    bool shellIndexEdge(){
+        cout << "TEST 56 RESULTS:" << endl; 
+
+        SatNet network;
+        vector<SatID> ids;
+        network.listShell(MI208, I48, ids);
+        if (network.countShell(MI208, I48) != 0 || !ids.empty()){
+            return false; 
+        }
+        for (SatID id = MINID; id < MINID + 1000; id++){
+            network.insert(Sat(id, static_cast<ALT>(id % 4), static_cast<INCLIN>(id / 4 % 4)));
+        }
+        // MI215 and I53 are the ids with id % 16 == 5
+        network.listShell(MI215, I53, MINID + 100, MINID + 200, ids);
+        vector<SatID> empty;
+        network.listShell(MI215, I53, MINID + 200, MINID + 100, empty);
+        if (ids.size() != 7 || ids.front() != MINID + 101 || ids.back() != MINID + 197 || !empty.empty() ||
+            network.countShell(MI215, I53) != 63){
+            return false; 
+        }
+        // a revived tombstone moves to the shell of its new attributes
+        network.setLazyRemove(true);
+        network.remove(MINID + 5);
+        network.insert(Sat(MINID + 5, MI350, I97));
+        ids.clear();
+        network.listShell(MI350, I97, MINID, MINID + 20, ids);
+        if (network.countShell(MI215, I53) != 62 || ids.size() != 2 || ids[0] != MINID + 5 || ids[1] != MINID + 15){
+            return false; 
+        }
+        // clear empties the shells that were used, the next inserts start from empty shells
+        network.clear();
+        network.insert(Sat(MINID + 15, MI350, I97));
+        ids.clear();
+        network.listShell(MI350, I97, ids);
+        if (network.countShell(MI215, I53) != 0 || ids.size() != 1 || ids[0] != MINID + 15){
+            return false; 
+        }
+        SatNet wide(INT64_MIN, INT64_MAX);
+        wide.insert(Sat(INT64_MIN, MI340, I70));
+        wide.insert(Sat(INT64_MAX, MI340, I70));
+        wide.insert(Sat(0, MI340, I48));
+        ids.clear();
+        wide.listShell(MI340, I70, ids);
+        return ids.size() == 2 && ids[0] == INT64_MIN && ids[1] == INT64_MAX && shellChecker(wide) && shellChecker(network); 
+    }
+
+    //Function: MappedSatNet
+    //Case: Normal case of building a catalog in a file, closing it and opening it again
+    //Expected result: the file matches a SatNet given the same operations before and after reopening, freed nodes are reused
+    bool mappedNormal(){
+        cout << "TEST 57 RESULTS:" << endl; 
+
+        const string fileName = "mapped_test.bin";
+        std::remove(fileName.c_str());
+        Random draw(0, 999999);
+        SatNet network;
+        bool same = true;
+        {
+            MappedSatNet mapped;
+            if (!mapped.open(fileName) || !mapped.wasClean()){
+                return false; 
+            }
+            for (int i = 0; i < 20000; i++){
+                int value = draw.getRandNum();
+                SatID id = MINID + value % 8000;
+                int op = value / 8000 % 10;
+                if (op < 6){
+                    Sat satellite(id, static_cast<ALT>(value % 4), static_cast<INCLIN>(value / 4 % 4));
+                    same = same && mapped.insert(satellite) == (network.insert(satellite) != nullptr);
+                }
+                else if (op < 9){
+                    mapped.remove(id);
+                    network.remove(id);
+                }
+                else {
+                    same = same && mapped.setState(id, DECAYING) == network.setState(id, DECAYING);
+                }
+            }
+            same = same && mapped.size() == network.size() && mapped.countSatellites(I70) == network.countSatellites(I70) &&
+                   mapped.getFileBytes() > MAPPED_INITIAL_BYTES;
+        }
+        MappedSatNet reopened;
+        if (!same || !reopened.open(fileName, 0, 5) || !reopened.wasClean() || reopened.getMinID() != MINID){
+            std::remove(fileName.c_str());
+            return false; 
+        }
+        vector<Sat> expected;
+        vector<Sat> actual;
+        network.getSatellites(expected);
+        reopened.getSatellites(actual);
+        for (size_t i = 0; i < expected.size() && same; i++){
+            same = actual.size() == expected.size() && actual[i].getID() == expected[i].getID() &&
+                   actual[i].getAlt() == expected[i].getAlt() && actual[i].getInclin() == expected[i].getInclin() &&
+                   actual[i].getState() == expected[i].getState();
+        }
+        // removing everything and inserting as many again takes the nodes off the free list
+        uint64_t bytes = reopened.getFileBytes();
+        int count = reopened.size();
+        for (size_t i = 0; i < actual.size(); i++){
+            reopened.remove(actual[i].getID());
+        }
+        for (int i = 0; i < count; i++){
+            reopened.insert(Sat(MAXID - i));
+        }
+        same = same && reopened.size() == count && reopened.findSatellite(MAXID) && reopened.getFileBytes() == bytes;
+        reopened.close();
+        std::remove(fileName.c_str());
+        return same && expected.size() > 1000; 
+    }
+
+    //Function: MappedSatNet
+    //Case: Edge case of a file that isn't a catalog, a truncated or corrupted catalog, a crash before a sync or while growing and every sync mode
+    //Expected result: foreign, truncated and corrupted files are refused untouched, a copy taken before the sync isn't clean
+    bool mappedEdge(){
+        cout << "TEST 58 RESULTS:" << endl; 
+
+        const string fileName = "mapped_test.bin";
+        const string copyName = "mapped_copy.bin";
+        vector<TraceOp> ops(3);
+        writeTrace(fileName, ops);
+        vector<TraceOp> readBack;
+        MappedSatNet mapped;
+        if (mapped.open(fileName) || mapped.isOpen() || !readTrace(fileName, readBack) || readBack.size() != 3){
+            std::remove(fileName.c_str());
+            return false; 
+        }
+        std::remove(fileName.c_str());
+        if (!mapped.open(fileName) || mapped.insert(Sat(MINID - 1)) || !mapped.insert(Sat(MINID)) || mapped.insert(Sat(MINID)) ||
+            mapped.setState(MINID + 1, DECAYING) || mapped.countSatellites(I48) != 1){
+            return false; 
+        }
+        // the page cache already has the insert, a copy of the file is what a crash would leave
+        ifstream source(fileName, ios::binary);
+        ofstream copy(copyName, ios::binary);
+        copy << source.rdbuf();
+        source.close();
+        copy.close();
+        bool dirtyCopy = mapped.m_header->clean == 0;
+        mapped.setSyncMode(SYNC_EVERY_OP);
+        mapped.insert(Sat(MINID + 1));
+        mapped.insert(Sat(MINID + 1));
+        bool syncedEveryOp = mapped.m_header->clean == 1;
+        mapped.setSyncMode(SYNC_ASYNC);
+        // removing a missing id or inserting a duplicate doesn't touch the file
+        mapped.remove(MINID + 5);
+        mapped.insert(Sat(MINID + 1));
+        syncedEveryOp = syncedEveryOp && mapped.m_header->clean == 1;
+        mapped.remove(MINID);
+        bool asyncDirty = mapped.m_header->clean == 0 && mapped.size() == 1;
+        mapped.clear();
+        mapped.close();
+        MappedSatNet crashed;
+        bool crashedOpen = crashed.open(copyName);
+        bool recovered = crashedOpen && !crashed.wasClean() && crashed.findSatellite(MINID) && crashed.size() == 1;
+        crashed.close();
+        // a root or free list outside the nodes or between two of them is refused
+        bool corruptOpen = false;
+        uint64_t links[] = {1 << 30, sizeof(MappedHeader) + 1};
+        for (uint64_t link : links){
+            for (size_t field : {offsetof(MappedHeader, root), offsetof(MappedHeader, freeList)}){
+                fstream header(copyName, ios::binary | ios::in | ios::out);
+                uint64_t saved;
+                header.seekg(field);
+                header.read(reinterpret_cast<char*>(&saved), sizeof(saved));
+                header.seekp(field);
+                header.write(reinterpret_cast<const char*>(&link), sizeof(link));
+                header.close();
+                corruptOpen = corruptOpen || crashed.open(copyName);
+                header.open(copyName, ios::binary | ios::in | ios::out);
+                header.seekp(field);
+                header.write(reinterpret_cast<const char*>(&saved), sizeof(saved));
+            }
+        }
+        bool restoredOpen = crashed.open(copyName) && crashed.findSatellite(MINID);
+        crashed.close();
+        // a file that grew without its header reaching the disk opens with the size of the file
+        truncate(copyName.c_str(), 2 * MAPPED_INITIAL_BYTES);
+        bool grownOpen = crashed.open(copyName) && !crashed.wasClean() && crashed.findSatellite(MINID) &&
+                         crashed.getFileBytes() == 2 * MAPPED_INITIAL_BYTES;
+        crashed.close();
+        grownOpen = grownOpen && crashed.open(copyName) && crashed.wasClean();
+        crashed.close();
+        // a catalog that was cut short is refused
+        truncate(copyName.c_str(), 100);
+        bool truncatedOpen = crashed.open(copyName);
+        MappedSatNet empty;
+        bool emptyOpen = empty.open(fileName);
+        bool cleared = emptyOpen && empty.size() == 0 && empty.getFileBytes() == MAPPED_INITIAL_BYTES;
+        empty.close();
+        std::remove(fileName.c_str());
+        std::remove(copyName.c_str());
+        return dirtyCopy && syncedEveryOp && asyncDirty && recovered && !corruptOpen && restoredOpen && grownOpen &&
+               !truncatedOpen && cleared && !empty.sync(); 
+    }
+
+    //Function: ForkSnapshot and loadSnapshot
+    //Case: Normal case of a snapshot being written while the parent removes and inserts satellites
+    //Expected result: the snapshot holds the network as it was at the fork and the progress reaches the total
+    bool forkSnapshotNormal(){
+        cout << "TEST 59 RESULTS:" << endl; 
+
+        const string fileName = "snapshot_test.bin";
+        SatNet network(0, 10000000);
+        for (SatID id = 0; id < 300000; id++){
+            network.insert(Sat(id * 3, static_cast<ALT>(id % 4), static_cast<INCLIN>(id / 4 % 4), static_cast<STATE>(id % 3)));
+        }
+        network.setLazyRemove(true);
+        network.remove(3);
+        SatNet before;
+        before = network;
+        ForkSnapshot snapshot;
+        if (!snapshot.start(network, fileName) || snapshot.getStatus() != SNAP_RUNNING || snapshot.getTotal() != 299999){
+            return false; 
+        }
+        // the parent's changes after the fork are copied on write and the child doesn't see them
+        network.setLazyRemove(false);
+        for (SatID id = 0; id < 100000; id++){
+            network.remove(id * 3);
+            network.insert(Sat(id * 3 + 1));
+            network.setState(id * 3 + 150000, DEORBITED);
+        }
+        double progress = snapshot.getProgress();
+        while (snapshot.poll() == SNAP_RUNNING){
+            progress = max(progress, snapshot.getProgress());
+            usleep(1000);
+        }
+        SatNet loaded(0, 10000000);
+        bool read = loadSnapshot(fileName, loaded);
+        std::remove(fileName.c_str());
+        return snapshot.getStatus() == SNAP_DONE && snapshot.getWritten() == 299999 && snapshot.getProgress() == 1 &&
+               progress <= 1 && read && sameSatellites(before, loaded) && snapshot.getPauseNs() > 0; 
+    }
+
+    //Function: ForkSnapshot and loadSnapshot
+    //Case: Edge case of an empty network, a second start while one runs, a path that can't be written and files that aren't snapshots
+    //Expected result: the empty snapshot loads as empty, the failures are reported and the old snapshot is kept
+    bool forkSnapshotEdge(){
+        cout << "TEST 60 RESULTS:" << endl; 
+
+        const string fileName = "snapshot_test.bin";
+        SatNet network;
+        network.insert(Sat(MINID));
+        ForkSnapshot snapshot;
+        SatNet empty;
+        if (snapshot.wait() != SNAP_IDLE || !snapshot.start(empty, fileName) || snapshot.start(network, fileName) ||
+            snapshot.wait() != SNAP_DONE || snapshot.getProgress() != 1){
+            std::remove(fileName.c_str());
+            return false; 
+        }
+        bool loadedEmpty = loadSnapshot(fileName, network) && network.size() == 0;
+        // a snapshot that fails leaves the last one in place
+        network.insert(Sat(MINID));
+        bool failed = snapshot.start(network, "missing_directory/snapshot_test.bin") && snapshot.wait() == SNAP_FAILED;
+        SatNet loaded;
+        loaded.insert(Sat(MAXID));
+        bool kept = loadSnapshot(fileName, loaded) && loaded.size() == 0;
+        // a trace isn't a snapshot and a missing file can't be loaded
+        vector<TraceOp> ops(2);
+        ops[0].op = T_INSERT;
+        ops[0].id = MINID + 1;
+        writeTrace(fileName, ops);
+        bool refused = !loadSnapshot(fileName, loaded) && loaded.size() == 0;
+        std::remove(fileName.c_str());
+        return loadedEmpty && failed && kept && refused && !loadSnapshot(fileName, loaded); 
+    }
+
+    //Function: CatalogWriter, CatalogReader, saveCatalog and loadCatalog
+    //Case: Normal case of a dense catalog and a sparse one saved, loaded, streamed, read by range and sent to a replica
+    //Expected result: every read gives back the same satellites and the dense catalog is over 5 times smaller than the raw records
+    bool catalogNormal(){
+        cout << "TEST 61 RESULTS:" << endl; 
+
+        const string fileName = "catalog_test.bin";
+        Random draw(0, 999999);
+        SatNet dense;
+        SatNet sparse(0, INT64_MAX);
+        for (SatID id = MINID; id <= MAXID; id++){
+            int value = draw.getRandNum();
+            dense.insert(Sat(id, static_cast<ALT>(value % 4), static_cast<INCLIN>(value / 4 % 4), static_cast<STATE>(value / 16 % 3)));
+            sparse.insert(Sat(SatID(value) * value * 1000 + id, static_cast<ALT>(value % 4)));
+        }
+        SatNet loaded;
+        SatNet loadedSparse(0, INT64_MAX);
+        if (!saveCatalog(dense, fileName) || !loadCatalog(fileName, loaded) || !sameSatellites(dense, loaded)){
+            std::remove(fileName.c_str());
+            return false; 
+        }
+        CatalogReader reader;
+        vector<Sat> range;
+        vector<Sat> streamed;
+        Sat satellite;
+        bool read = reader.open(fileName) && reader.size() == dense.size() && reader.readRange(MINID + 1000, MINID + 1299, range);
+        while (read && reader.next(satellite)){
+            streamed.push_back(satellite);
+        }
+        ifstream file(fileName, ios::binary | ios::ate);
+        bool smaller = file.tellg() * 5 < 11LL * dense.size();
+        file.close();
+        reader.close();
+        bool sparseSame = saveCatalog(sparse, fileName) && loadCatalog(fileName, loadedSparse) && sameSatellites(sparse, loadedSparse);
+        std::remove(fileName.c_str());
+        if (!read || !smaller || !sparseSame || range.size() != 300 || range.front().getID() != MINID + 1000 ||
+            int(streamed.size()) != dense.size() || streamed.back().getID() != MAXID){
+            return false; 
+        }
+        // a replica's snapshot goes over the wire as a catalog
+        ChangeLog log;
+        ChangeBatch snapshot = makeSnapshot(dense, log);
+        ChangeBatch received;
+        vector<unsigned char> data;
+        encodeBatch(snapshot, data);
+        Replica replica;
+        return data[0] == BATCH_CATALOG && data.size() * 5 < 11 * snapshot.ops.size() && decodeBatch(data, received) &&
+               received.snapshot && replica.apply(received) && sameSatellites(dense, replica.getNetwork()); 
+    }
+
+    //Function: CatalogWriter and CatalogReader
+    //Case: Edge case of an empty catalog, ids across the whole 64-bit range, ids out of order and broken encodings
+    //Expected result: the extreme ids come back, out of order ids are refused and broken encodings aren't read
+    bool catalogEdge(){
+        cout << "TEST 62 RESULTS:" << endl; 
+
+        CatalogWriter writer;
+        CatalogReader reader;
+        vector<Sat> satellites;
+        writer.open();
+        writer.close();
+        vector<unsigned char> empty = writer.getData();
+        if (!reader.open(empty.data(), empty.size()) || reader.size() != 0 || !reader.readAll(satellites) || !satellites.empty()){
+            return false; 
+        }
+        // gaps of 63 and 64 bits take the decoder's two load path
+        SatID ids[] = {INT64_MIN, -5, 0, 7, INT64_MAX};
+        writer.open();
+        for (int i = 0; i < 5; i++){
+            writer.add(Sat(ids[i], MI350, I97, DECAYING));
+        }
+        if (writer.add(Sat(0)) || !writer.close() || writer.getCount() != 5){
+            return false; 
+        }
+        vector<unsigned char> data = writer.getData();
+        if (!reader.open(data.data(), data.size()) || !reader.readAll(satellites) || satellites.size() != 5 ||
+            !reader.readRange(-5, 6, satellites) || satellites.size() != 7 || !reader.readRange(8, 1, satellites)){
+            return false; 
+        }
+        for (int i = 0; i < 5; i++){
+            if (satellites[i].getID() != ids[i] || satellites[i].getState() != DECAYING || satellites[i].getInclin() != I97){
+                return false; 
+            }
+        }
+        // a state of 3 in the last attribute byte, a cut short encoding and a wrong magic
+        vector<unsigned char> badState = data;
+        badState[data.size() - 32 - 16 - 1] |= 0x30;
+        vector<unsigned char> cut(data.begin(), data.end() - 1);
+        vector<unsigned char> badMagic = data;
+        badMagic[0] = 'X';
+        satellites.clear();
+        bool brokenRead = reader.open(badState.data(), badState.size()) && !reader.readAll(satellites);
+        return brokenRead && !reader.open(cut.data(), cut.size()) && !reader.open(badMagic.data(), badMagic.size()) &&
+               !reader.open("missing_catalog.bin"); 
+    }
+
+    //Function: SatNet::compact
+    //Case: Normal case of a churned network with tombstones compacted in both layouts and changed in between
+    //Expected result: the satellites, the shape and the indexes are unchanged, the nodes sit in one block and the old block is freed
+    bool compactNormal(){
+        cout << "TEST 63 RESULTS:" << endl; 
+
+        int slabs = NodeSlab::getSlabs();
+        Random draw(0, 999999);
+        SatNet network;
+        SatNet expected;
+        network.setLazyRemove(true);
+        for (int round = 0; round < 4; round++){
+            for (int i = 0; i < 5000; i++){
+                int value = draw.getRandNum();
+                SatID id = MINID + value % 20000;
+                if (value / 20000 % 3 == 0){
+                    network.remove(id);
+                    expected.remove(id);
+                }
+                else {
+                    Sat satellite(id, static_cast<ALT>(value % 4), static_cast<INCLIN>(value / 4 % 4));
+                    network.insert(satellite);
+                    expected.insert(satellite);
+                }
+            }
+            int height = network.m_root->getHeight();
+            int tombstones = network.getTombstones();
+            network.compact(round % 2 == 0 ? LAYOUT_VEB : LAYOUT_BFS);
+            if (!sameSatellites(network, expected) || !bstChecker(network.m_root) || !balanceChecker(network.m_root) ||
+                !sizeChecker(network.m_root) || !indexChecker(network) || !shellChecker(network) ||
+                network.m_root->getHeight() != height || network.getTombstones() != tombstones ||
+                !blockChecker(network.m_root, network.m_root, network.m_nodes) || NodeSlab::getSlabs() != slabs + 1){
+                return false; 
+            }
+        }
+        // breadth first puts the children of the root right after it
+        Sat* root = network.m_root;
+        if (root->m_left != root + 1 || root->m_right != root + 2){
+            return false; 
+        }
+        network.clear();
+        return NodeSlab::getSlabs() == slabs; 
+    }
+
+    //Function: SatNet::beginCompact and SatNet::compactStep
+    //Case: Edge case of an empty network, changes and cached lookups between steps, a compacted network split and cleared in the background
+    //Expected result: nothing is moved twice or lost, the cache never returns a moved node and a block is freed with its last node
+    bool compactEdge(){
+        cout << "TEST 64 RESULTS:" << endl; 
+
+        int slabs = NodeSlab::getSlabs();
+        SatNet network;
+        network.compact();
+        network.beginCompact();
+        if (network.isCompacting() || !network.compactStep(10) || NodeSlab::getSlabs() != slabs){
+            return false; 
+        }
+        SatNet expected;
+        for (SatID id = MINID; id < MINID + 3000; id++){
+            network.insert(Sat(id));
+            expected.insert(Sat(id));
+        }
+        network.setLookupCache(64);
+        network.beginCompact(LAYOUT_BFS);
+        int steps = 0;
+        for (SatID id = MINID; !network.compactStep(100); id += 7){
+            steps++;
+            // a removed id is skipped, a new one stays on the heap and a cached node is forgotten once moved
+            network.findSatellite(id + 1);
+            network.remove(id);
+            expected.remove(id);
+            network.insert(Sat(id + 5000));
+            expected.insert(Sat(id + 5000));
+            if (!network.setState(id + 1, DECAYING) || !expected.setState(id + 1, DECAYING)){
+                return false; 
+            }
+        }
+        if (steps != 29 || network.isCompacting() || !sameSatellites(network, expected) || !bstChecker(network.m_root) ||
+            !balanceChecker(network.m_root) || !indexChecker(network) || NodeSlab::getSlabs() != slabs + 1){
+            return false; 
+        }
+        // the nodes split off keep the block alive after their old network is cleared
+        SatNet right;
+        network.compact();
+        network.split(MINID + 1500, right);
+        network.clear();
+        if (NodeSlab::getSlabs() != slabs + 1 || right.size() != 1529 || !right.findSatellite(MINID + 2999)){
+            return false; 
+        }
+        right.setBackgroundClear(true);
+        right.clear();
+        Reclaimer::instance().drain();
+        bool freed = NodeSlab::getSlabs() == slabs;
+        // clearing in the middle of an incremental compact frees the unfinished block
+        network.insert(Sat(MINID));
+        network.beginCompact();
+        network.clear();
+        return freed && !network.isCompacting() && NodeSlab::getSlabs() == slabs; 
+    }
+
+    //Function: SatNet::setState with a deadline and SatNet::expireDecaying
+    //Case: Normal case of deadlines set, replaced, cancelled by state changes and removes, with eager and lazy removal
+    //Expected result: after every step exactly the satellites whose deadline passed are DEORBITED and a replica sees the same changes
+    bool expireNormal(){
+        cout << "TEST 65 RESULTS:" << endl; 
+
+        const int COUNT = 2000;
+        Random draw(0, 999999);
+        SatNet network;
+        ChangeLog log(1 << 20);
+        network.recordChanges(&log);
+        // the state of every id, -1 if it isn't in the network, and its deadline if it has one
+        vector<int> states(COUNT, ACTIVE);
+        vector<long long> deadlines(COUNT, 0);
+        vector<bool> scheduled(COUNT, false);
+        for (int i = 0; i < COUNT; i++){
+            network.insert(Sat(MINID + i));
+        }
+        long long now = 0;
+        for (int round = 0; round < 20; round++){
+            network.setLazyRemove(round >= 10);
+            for (int i = 0; i < 300; i++){
+                int value = draw.getRandNum();
+                int index = value % COUNT;
+                int op = value / COUNT % 10;
+                bool live = states[index] >= 0;
+                if (op < 5){
+                    // some deadlines are already in the past
+                    long long deadline = now + value / 20000 % 1000 - 100;
+                    if (network.setState(MINID + index, DECAYING, deadline) != live){
+                        return false; 
+                    }
+                    if (live){
+                        states[index] = DECAYING;
+                        deadlines[index] = deadline;
+                        scheduled[index] = true;
+                    }
+                }
+                else if (op < 7 || op == 9){
+                    STATE state = op == 9 ? DECAYING : ACTIVE;
+                    network.setState(MINID + index, state);
+                    if (live){
+                        states[index] = state;
+                        scheduled[index] = false;
+                    }
+                }
+                else if (op == 7){
+                    network.remove(MINID + index);
+                    states[index] = -1;
+                    scheduled[index] = false;
+                }
+                else if (!live){
+                    network.insert(Sat(MINID + index));
+                    states[index] = ACTIVE;
+                }
+            }
+            now += 250;
+            int expected = 0;
+            int pending = 0;
+            for (int i = 0; i < COUNT; i++){
+                if (scheduled[i] && deadlines[i] <= now){
+                    states[i] = DEORBITED;
+                    scheduled[i] = false;
+                    expected++;
+                }
+                pending += scheduled[i];
+            }
+            if (network.expireDecaying(now) != expected || network.getDeadlines() != pending){
+                return false; 
+            }
+            vector<Sat> satellites;
+            network.getSatellites(satellites);
+            for (size_t i = 0; i < satellites.size(); i++){
+                if (satellites[i].getState() != states[satellites[i].getID() - MINID]){
+                    return false; 
+                }
+            }
+        }
+        Replica replica;
+        return replica.catchUp(log) && sameSatellites(network, replica.getNetwork()); 
+    }
+
+    //Function: SatNet::expireDecaying
+    //Case: Edge case of missing ids, far and past deadlines, a clock going back, purging, handles, bulk changes and split and join
+    //Expected result: only live DECAYING satellites get a deadline, far deadlines fire on time and every bulk change drops the deadlines it should
+    bool expireEdge(){
+        cout << "TEST 66 RESULTS:" << endl; 
+
+        SatNet network;
+        if (network.expireDecaying(100) != 0 || network.setState(MINID, DECAYING, 5) || network.getDeadlines() != 0){
+            return false; 
+        }
+        SatHandle handle = network.insert(Sat(MINID));
+        network.insert(Sat(MINID + 1));
+        network.insert(Sat(MAXID, MI208, I48, DEORBITED));
+        // only DECAYING takes a deadline
+        network.setState(MINID, ACTIVE, 5);
+        long long deadline = 0;
+        if (network.getDeadlines() != 0 || network.getDeadline(MINID, deadline)){
+            return false; 
+        }
+        // a deadline in the top levels of the wheel
+        network.setState(MINID, DECAYING, 1LL << 62);
+        if (network.expireDecaying(1LL << 61) != 0 || !network.getDeadline(MINID, deadline) || deadline != 1LL << 62 ||
+            network.expireDecaying((1LL << 62) - 1) != 0 || network.expireDecaying(1LL << 62) != 1){
+            return false; 
+        }
+        // a deadline before the wheel's time is due at the next call even if the clock went back
+        network.setState(MINID, DECAYING, 5);
+        network.setState(MINID + 1, DECAYING, 5);
+        if (network.expireDecaying(0, true) != 2 || network.size() != 0 || network.findSatellite(MAXID)){
+            return false; 
+        }
+        // a handle, updateWhere and removeWhere drop the deadlines of the satellites they change
+        handle = network.insert(Sat(MINID));
+        network.insert(Sat(MINID + 1));
+        network.insert(Sat(MINID + 2));
+        for (SatID id = MINID; id <= MINID + 2; id++){
+            network.setState(id, DECAYING, (1LL << 62) + 10);
+        }
+        network.setState(handle, ACTIVE);
+        network.updateWhere([](const Sat& satellite){return satellite.getID() == MINID + 1;}, DECAYING);
+        network.removeWhere([](const Sat& satellite){return satellite.getID() == MINID + 2;});
+        if (network.getDeadlines() != 0){
+            return false; 
+        }
+        // deadlines don't follow satellites into another network
+        SatNet right;
+        network.insert(Sat(MINID + 500));
+        network.setState(MINID + 1, DECAYING, (1LL << 62) + 20);
+        network.setState(MINID + 500, DECAYING, (1LL << 62) + 20);
+        network.split(MINID + 100, right);
+        if (network.getDeadlines() != 1 || right.getDeadlines() != 0 || right.expireDecaying(INT64_MAX) != 0){
+            return false; 
+        }
+        network.clear();
+        return network.getDeadlines() == 0 && network.expireDecaying((1LL << 62) + 20) == 0; 
+    }
+
+    //Function: CatalogReader, loadCatalog and decodeBatch
+    //Case: Edge case of hand made catalogs whose last block claims more satellites than a block holds or than the footer counts
+    //Expected result: the malformed catalogs are refused from memory, from a file and from a replica batch, the well formed one is read
+    bool catalogMalformedEdge(){
+        cout << "TEST 67 RESULTS:" << endl; 
+
+        const string fileName = "catalog_malformed.bin";
+        CatalogReader reader;
+        vector<Sat> satellites;
+        vector<unsigned char> good = craftCatalog(100, 100);
+        if (!reader.open(good.data(), good.size()) || !reader.readAll(satellites) || satellites.size() != 100 ||
+            satellites.back().getID() != MINID + 99){
+            return false; 
+        }
+        // 256 satellites in the last block fit every offset of the file but not the decoder's buffers
+        vector<unsigned char> oversized = craftCatalog(256, 128);
+        vector<unsigned char> miscounted = craftCatalog(100, 101);
+        if (reader.open(oversized.data(), oversized.size()) || reader.open(miscounted.data(), miscounted.size())){
+            return false; 
+        }
+        ofstream file(fileName, ios::binary);
+        file.write(reinterpret_cast<const char*>(oversized.data()), oversized.size());
+        file.close();
+        SatNet network;
+        bool loaded = loadCatalog(fileName, network) || loadSnapshot(fileName, network);
+        std::remove(fileName.c_str());
+        // a snapshot batch from a replica's peer, the catalog follows the flag and the sequence number
+        vector<unsigned char> batch = {BATCH_CATALOG, 1};
+        batch.insert(batch.end(), oversized.begin(), oversized.end());
+        ChangeBatch received;
+        return !loaded && network.size() == 0 && !decodeBatch(batch, received); 
+    }
+
+    //Function: SatNet::unionWith, SatNet::difference, SatNet::extractRange and SatNet::join
+    //Case: Edge case of bulk operations that touch one satellite of a network with a wide id range, a lookup cache and deadlines
+    //Expected result: the indexes, the cache and the deadlines change only for the satellites that were touched
+    bool bulkIndexEdge(){
+        cout << "TEST 68 RESULTS:" << endl; 
+
+        SatNet network(0, 4000000);
+        network.setLookupCache();
+        for (SatID id = 0; id < 4000000; id += 400){
+            network.insert(Sat(id, static_cast<ALT>(id / 400 % 4), I53));
+        }
+        network.setState(400, DECAYING, 50);
+        network.setState(800, DECAYING, 60);
+        network.findSatellite(400);
+        network.findSatellite(800);
+        // one satellite changes shell and one is added
+        SatNet one(0, 4000000);
+        one.insert(Sat(400, MI350, I97, DECAYING));
+        one.insert(Sat(401, MI350, I97));
+        network.unionWith(one);
+        long long deadline = 0;
+        if (network.getDeadline(400, deadline) || !network.getDeadline(800, deadline) || deadline != 60 ||
+            !network.findSatellite(401) || network.countShell(MI350, I97) != 2 || network.countShell(MI215, I53) != 2499){
+            return false; 
+        }
+        SatNet gone(0, 4000000);
+        gone.insert(Sat(401));
+        network.difference(gone);
+        // a small range moves out with its deadline dropped and comes back
+        SatNet range;
+        network.extractRange(700, 900, range);
+        if (network.findSatellite(800) || !range.findSatellite(800) || range.size() != 1 || range.getMinID() != 0 ||
+            range.getDeadlines() != 0 || network.getDeadlines() != 0 || !indexChecker(range) || !shellChecker(range)){
+            return false; 
+        }
+        network.join(range);
+        if (network.size() != 10000 || range.size() != 0 || !network.findSatellite(800) || network.findSatellite(401) ||
+            !indexChecker(network) || !shellChecker(network)){
+            return false; 
+        }
+        // the parallel versions touch enough satellites to be split over the tasks
+        TaskPool pool(2);
+        SatNet other(0, 4000000);
+        for (SatID id = 0; id < 4000000; id += 800){
+            other.insert(Sat(id + 400, MI208, I70));
+        }
+        network.unionWith(other, pool);
+        if (network.countShell(MI208, I70) != 5000 || !indexChecker(network) || !shellChecker(network)){
+            return false; 
+        }
+        network.difference(other, pool);
+        return network.size() == 5000 && !network.findSatellite(1200) && network.findSatellite(1600) &&
+               indexChecker(network) && shellChecker(network); 
+    }
+
+    //Function: the batch command driver (batch.cpp)
+    //Case: Edge case of a script with comments, blank lines, malformed commands, CRLF line ends, the smallest and
+    //largest 64-bit ids and a last line without a newline, read both from a mapped file and from a pipe
+    //Expected result: every command line prints one result or "error" in order and the exit code reports the errors
+    bool batchEdge(){
+        cout << "TEST 69 RESULTS:" << endl; 
+
+        const string scriptName = "batch_test.txt";
+        const string outName = "batch_out.txt";
+        ofstream script(scriptName, ios::binary);
+        script << "# a comment\n"
+               << "insert 10000 208 48 active\n"
+               << "insert 10000 215 53 active\n"
+               << "insert -9223372036854775808 350 97 deorbited\n"
+               << "insert 9223372036854775807 3 3 2\n"
+               << "insert 9223372036854775808 208 48 active\n"
+               << "find -9223372036854775808\n"
+               << "insert 10001 209 48 active\n"
+               << "set 10000 decaying\n"
+               << "set 10002 active\n"
+               << "\n"
+               << "   \t\n"
+               << "count 48\n"
+               << "count 97\r\n"
+               << "launch 10003\n"
+               << "find 10000 10001\n"
+               << "find\n"
+               << "purge\n"
+               << "remove 10000\n"
+               << "remove 10000\n"
+               << "find 9223372036854775807";
+        script.close();
+        const vector<string> expected = {"1", "0", "1", "1", "error", "1", "error", "1", "0", "1", "2",
+                                         "error", "error", "error", "1", "1", "0", "1"};
+        bool same = true;
+        const string commands[] = {"./batch " + scriptName, "cat " + scriptName + " | ./batch"};
+        for (const string& command : commands){
+            int status = system((command + " > " + outName + " 2> /dev/null").c_str());
+            ifstream output(outName);
+            vector<string> lines;
+            string line;
+            while (getline(output, line)){
+                lines.push_back(line);
+            }
+            same = same && WIFEXITED(status) && WEXITSTATUS(status) == 2 && lines == expected;
+        }
+        std::remove(scriptName.c_str());
+        std::remove(outName.c_str());
+        return same; 
+    }
+
+    //Function: AvlCatalog, the tree engine of avlcatalog.h on a key, payload and key range other than SatNet's
+    //Case: Normal case of a catalog of debris over int keys 0 - 999 with a mass payload
+    //Expected result: the range is checked at compile time, ascending and removed keys leave a balanced tree,
+    //find, rank and forEach agree with the inserted keys and a copy is independent of the original
+    bool avlCatalogNormal(){
+        cout << "TEST 70 RESULTS:" << endl; 
+
+        typedef AvlCatalog<int, Debris, 0, 999> DebrisCatalog;
+        static_assert(DebrisCatalog::inRange(0) && DebrisCatalog::inRange(999) && !DebrisCatalog::inRange(-1) &&
+                      !DebrisCatalog::inRange(1000) && !DebrisCatalog::FULL_RANGE, "0 - 999 is checked");
+        static_assert(SatCatalog::FULL_RANGE && SatCatalog::inRange(INT64_MIN) && SatCatalog::inRange(INT64_MAX),
+                      "SatNet's catalog takes every id");
+        static_assert(CatalogKey<double> && !CatalogKey<string>, "keys must be ordered and trivially copyable");
+        static_assert(is_same_v<Sat, SatCatalog::Node>, "Sat is the node of SatNet's catalog");
+        DebrisCatalog catalog;
+        bool result = true;
+        for (int i = 0; i < 1000; i += 2){
+            result = result && catalog.insert(i, Debris(i * 0.5)) != nullptr;
+        }
+        result = result && catalog.insert(1000, Debris()) == nullptr && catalog.insert(-1, Debris()) == nullptr &&
+                 catalog.insert(4, Debris()) == nullptr && catalog.size() == 500;
+        // 500 ascending keys take height 8, an unbalanced tree would be a list
+        result = result && catalog.m_root->getHeight() <= 9;
+        for (int i = 0; i < 1000; i += 4){
+            result = result && catalog.remove(i);
+        }
+        result = result && !catalog.remove(0) && !catalog.remove(1000) && catalog.size() == 250;
+        const DebrisCatalog::Node* found = catalog.find(6);
+        result = result && found != nullptr && found->getMass() == 3 && !catalog.contains(4) &&
+                 !catalog.contains(7) && catalog.rank(6) == 1 && catalog.rank(1000) == 250;
+        DebrisCatalog copy(catalog);
+        copy.remove(6);
+        int expected = 2;
+        bool ordered = true;
+        catalog.forEach([&](const DebrisCatalog::Node& node){
+            ordered = ordered && node.getID() == expected && node.getMass() == expected * 0.5;
+            expected += 4;
+        });
+        return result && ordered && expected == 1002 && copy.size() == 249 && catalog.contains(6) &&
+               catalogChecker(catalog.m_root, -1, 1000); 
+    }
+    private:
+    
+    /**********************************************
+    * If we need helper functions to be reused in *
+    *   test functions they can be declared here!
+    **********************************************/
+
+    // this helper checks the order, the balance and the subtree sizes of a catalog with any key and payload,
+    // every key must be between low and high
+    template <class Node>
+    bool catalogChecker(const Node* node, long long low, long long high) const{
+        if (node == nullptr) {
+            return true;
+        }
+        int leftHeight = node->m_left == nullptr ? -1 : node->m_left->m_height;
+        int rightHeight = node->m_right == nullptr ? -1 : node->m_right->m_height;
+        int leftSize = node->m_left == nullptr ? 0 : node->m_left->m_size;
+        int rightSize = node->m_right == nullptr ? 0 : node->m_right->m_size;
+        return low < node->m_id && node->m_id < high && abs(leftHeight - rightHeight) <= 1 &&
+               node->m_height == 1 + max(leftHeight, rightHeight) && node->m_size == leftSize + rightSize + 1 &&
+               catalogChecker(node->m_left, low, node->m_id) && catalogChecker(node->m_right, node->m_id, high);
+    }
+    // this helper outputs all the nodes in the tree
+    string out(Sat* satellite) const{
+        string result = "";
+        if (satellite != nullptr){
+            result += "(";
+            result += out(satellite->m_left);  // first visit the left child
+            result += to_string(satellite->m_id) + ":" + to_string(satellite->m_height);  // second visit the node itself
+            result += out(satellite->m_right);  // third visit the right child
+            result += ")";
+        }
+        return result; 
+    }
+    
+    // this helper makes sure that the tree is balanced
+    bool balanceChecker(Sat* node) {
+        // base case
+        if (node == nullptr) {
+            return true;
+        }
+        
+        // initilaize varaibles
+        int leftHeight = -1;
+        int rightHeight = -1;
+        
+        if (node->m_left != nullptr) {
+            leftHeight = node->m_left->m_height;
+        }
+
+        if (node->m_right != nullptr) {
+            rightHeight = node->m_right->m_height;
+        }
+        
+        // make sure that the difference is less than 1
+        if (abs(leftHeight - rightHeight) <= 1) {
+            // recursive call 
+            if (balanceChecker(node->m_left) && balanceChecker(node->m_right)) {
+                return true;
+            }
+        }
+    
+        return false;
+    }
+
+    // this helper makes sure that the bst property is maintained
+    bool bstChecker(Sat* node, Sat* min = nullptr, Sat* max = nullptr) {
+        // an empty network is a binary seach network by definition
+        if (node == nullptr) {
+            return true;
+        }
+
+        // check if the value is bounded by the max and min
+        if (min != nullptr && node->getID() <= min->getID()) {
+            return false;
+        }
+        if (max != nullptr && node->getID() >= max->getID()) {
+            return false;
+        }
+
+        // recursive call 
+        if (bstChecker(node->m_left, min, node) && bstChecker(node->m_right, node, max)){
+            return true; 
+        }
+
+        return false;
+    }
+    
+    // this helper makes sure that every node holds the number of live satellites in its subtree
+    bool sizeChecker(Sat* node) {
+        if (node == nullptr) {
+            return true;
+        }
+        int size = (node->isDeleted() ? 0 : 1);
+        if (node->m_left != nullptr) size += node->m_left->getSize();
+        if (node->m_right != nullptr) size += node->m_right->getSize();
+        return node->getSize() == size && sizeChecker(node->m_left) && sizeChecker(node->m_right);
+    }
+
+    // this helper makes sure that the count nodes of a compacted subtree all lie in the block starting at first
+    bool blockChecker(const Sat* node, const Sat* first, int count) {
+        if (node == nullptr) {
+            return true;
+        }
+        return node >= first && node < first + count && blockChecker(node->m_left, first, count) &&
+               blockChecker(node->m_right, first, count);
+    }
+
+    // this helper builds a one block catalog of blockCount consecutive ids from MINID by hand, with the
+    // footer claiming footerCount satellites, so a test can feed the reader block headers a writer never makes
+    vector<unsigned char> craftCatalog(int blockCount, uint64_t footerCount) {
+        vector<unsigned char> data(CATALOG_MAGIC, CATALOG_MAGIC + 8);
+        auto putU64 = [&data](uint64_t value) {
+            for (int i = 0; i < 8; i++) {
+                data.push_back((value >> (8 * i)) & 0xFF);
+            }
+        };
+        // the count minus 1, gaps of width 0 and the first id, then 6 bits of attributes per satellite
+        data.push_back(blockCount - 1);
+        data.push_back(0);
+        putU64(MINID);
+        data.resize(data.size() + (blockCount * 6 + 7) / 8, 0);
+        uint64_t indexOffset = data.size();
+        putU64(MINID);
+        putU64(8);
+        putU64(1);
+        putU64(footerCount);
+        putU64(indexOffset);
+        data.insert(data.end(), CATALOG_MAGIC, CATALOG_MAGIC + 8);
+        return data;
+    }
+
+    // this helper makes sure that two networks hold the same satellites with the same data
+    bool sameSatellites(const SatNet& lhs, const SatNet& rhs) {
+        vector<Sat> left;
+        vector<Sat> right;
+        lhs.getSatellites(left);
+        rhs.getSatellites(right);
+        if (left.size() != right.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < left.size(); i++) {
+            if (left[i].getID() != right[i].getID() || left[i].getAlt() != right[i].getAlt() ||
+                left[i].getInclin() != right[i].getInclin() || left[i].getState() != right[i].getState()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // this helper makes sure that the id index answers like the tree for every live id and some probes
+    bool indexChecker(const SatNet& network) {
+        vector<Sat> satellites;
+        network.getSatellites(satellites);
+        vector<SatID> ids;
+        network.getIDs(network.getMinID(), network.getMaxID(), ids);
+        if (ids.size() != satellites.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < ids.size(); i++) {
+            SatID next = 0;
+            SatID prev = 0;
+            bool hasNext = network.nextSatellite(ids[i], next);
+            bool hasPrev = network.prevSatellite(ids[i], prev);
+            if (ids[i] != satellites[i].getID() || hasNext != (i + 1 < ids.size()) || hasPrev != (i > 0) ||
+                (hasNext && next != ids[i + 1]) || (hasPrev && prev != ids[i - 1])) {
+                return false;
+            }
+        }
+        // ids that aren't in the network are answered like the tree answers them
+        // the width is taken unsigned so the whole 64-bit range doesn't overflow
+        Random probe(0, 999);
+        uint64_t width = uint64_t(network.getMaxID()) - uint64_t(network.getMinID());
+        for (int i = 0; i < 200 && width > 1000; i++) {
+            SatID id = SatID(uint64_t(network.getMinID()) + width / 1000 * probe.getRandNum());
+            SatID fromIndex = 0;
+            SatID fromTree = 0;
+            if (network.nextSatellite(id, fromIndex) != network.nextSatellite(network.m_root, id, fromTree) ||
+                fromIndex != fromTree ||
+                network.prevSatellite(id, fromIndex) != network.prevSatellite(network.m_root, id, fromTree) ||
+                fromIndex != fromTree) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // this helper makes sure that every shell lists and counts exactly the live satellites with its altitude and inclination
+    bool shellChecker(const SatNet& network) {
+        vector<Sat> satellites;
+        network.getSatellites(satellites);
+        vector<SatID> expected[NUM_SHELLS];
+        for (size_t i = 0; i < satellites.size(); i++) {
+            expected[SatNet::shellOf(satellites[i].getAlt(), satellites[i].getInclin())].push_back(satellites[i].getID());
+        }
+        for (int alt = MI208; alt <= MI350; alt++) {
+            for (int inclin = I48; inclin <= I97; inclin++) {
+                vector<SatID> ids;
+                network.listShell(static_cast<ALT>(alt), static_cast<INCLIN>(inclin), ids);
+                if (ids != expected[SatNet::shellOf(static_cast<ALT>(alt), static_cast<INCLIN>(inclin))] ||
+                    network.countShell(static_cast<ALT>(alt), static_cast<INCLIN>(inclin)) != int(ids.size())) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // this makes sure that none of the nodes have the deorbited state
+    bool removeDeorbitedChecker(Sat* node) {
+        // base case
+        if (node == nullptr) {
+            return true;
+        }
+        
+        // if deorbited state is present set as false
+        if (node->getState() == DEORBITED) {
+            return false;
+        }
+        
+        // recurse on rhs and lhs
+        if (!removeDeorbitedChecker(node->m_left) || !removeDeorbitedChecker(node->m_right)) {
+            return false;
+        }
+
+        return true;
+    }
+
+    // makes sure that two given trees are equal 
+    bool isEqual(const Sat* node1, const Sat* node2) const {
+        // base case
+        if (node1 == nullptr && node2 == nullptr) {
+            return true;
+        }
+
+        // if one of them is nullptr and the other is not
+        if (node1 == nullptr || node2 == nullptr) {
+            return false;
+        }
+        
+        // see if all the member vairables are the same
+        if (node1->getID() != node2->getID() ||
+            node1->getAlt() != node2->getAlt() ||
+            node1->getInclin() != node2->getInclin() ||
+            node1->getState() != node2->getState()) {
+            return false;
+        }
+        
+        // recurse on rhs and lhs
+        return isEqual(node1->m_left, node2->m_left) && isEqual(node1->m_right, node2->m_right);
+    }
+
+};
+
+int main(){
+    Tester tester;
+
+    cout << endl << "\033[1;31m=============================|Test Cases for the SATNET Class|==============================\033[0m" << endl;
+
+    cout << "________________________________________________________" << endl; 
+    
+    cout << "Test the insertion function for a normal case." << endl; 
+
+    if (tester.insertNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m insert function passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: insert function failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+    
+    cout << "Test the insertion function for a edge case where duplicates are inserted." << endl; 
+
+    if (tester.insertEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m insert function passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: insert function failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+    
+    cout << "Test the insertion function for a error case where nodes with invalid IDs are inserted." << endl; 
+
+    if (tester.insertError()) {
+        cout << "\033[1;32mSUCCESS\033[0m insert function passed for a error test" << endl;
+    } 
+    else {
+        cout << "FAILURE: insert function failed for a error test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+    
+    cout << "Test whether the network is balanced after a decent number of insertions, e.g. 300 insertions." << endl; 
+
+    if (tester.balanceCheckerInsert()) {
+        cout << "\033[1;32mSUCCESS\033[0m balance check passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: balance check failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+    
+    cout << "Test whether the BST property is preserved after all insertions. (Note: this requires visiting all nodes and comparing key values)" << endl; 
+
+    if (tester.bstCheckerInsert()) {
+        cout << "\033[1;32mSUCCESS\033[0m BST check passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: BST check failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the remove function for a normal case." << endl; 
+
+    if (tester.removeNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m remove function passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: remove function failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the remove function for a edge case where you are removing values that don't exist." << endl; 
+
+    if (tester.removeEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m remove function passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: remove function failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test whether the network is balanced after multiple removals. For example, insert 300 nodes, then remove 150, and check the property." << endl; 
+
+    if (tester.balanceCheckerRemove()) {
+        cout << "\033[1;32mSUCCESS\033[0m balance check passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: balance check failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test whether the BST property is preserved after multiple removals." << endl; 
+
+    if (tester.bstCheckerRemove()) {
+        cout << "\033[1;32mSUCCESS\033[0m BST check passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: BST check failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the removeDeorbited() functionality for a normal test" << endl; 
+
+    if (tester.removeDeorbitedNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m RemoveDeorbited passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: RemoveDeorbited failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the removeDeorbited() functionality for a edge test where there are no deorbited nodes" << endl; 
+
+    if (tester.removeDeorbitedEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m RemoveDeorbited passed for a edge test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: RemoveDeorbited failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the countSatellites() functionality for a normal case" << endl; 
+
+    if (tester.countSatellitesNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m countSatellites passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: countSatellites failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the countSatellites() functionality for a edge case where no satellites of that incline are there" << endl; 
+
+    if (tester.countSatellitesEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m countSatellites passed for a edge test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: countSatellites failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the findSatellite(...) functionality for a normal case." << endl; 
+
+    if (tester.findSatelliteNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m findSatellite passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: findSatellite failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the findSatellite(...) functionality for a error case where no such node exists" << endl; 
+
+    if (tester.findSatelliteError()) {
+        cout << "\033[1;32mSUCCESS\033[0m findSatellite passed for a error test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: findSatellite failed for a error test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the assignment operator for a normal case." << endl; 
+
+    if (tester.assignmentNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m assignment operator passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: assignment operator failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the assignment operator for an error case, e.g. assigning an empty object to an empty object." << endl; 
+
+    if (tester.assignmentError()) {
+        cout << "\033[1;32mSUCCESS\033[0m assignment operator passed for a error test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: assignment operator failed for a error test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Prove that the removal performs in O(log n). " << endl; 
+
+    if (tester.removePerformanceChecker()) {
+        cout << "\033[1;32mSUCCESS\033[0m The removal passed for a time complexity test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: The removal failed for a time complexity test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Prove that the insertion performs in O(log n). " << endl; 
+
+    if (tester.insertPerformanceChecker()) {
+        cout << "\033[1;32mSUCCESS\033[0m The insertion passed for a time complexity test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: The insertion failed for a time complexity test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the setState functionality for a normal case" << endl; 
+
+    if (tester.setStateNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m setState passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: setState failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the setState functionality for a edge case where it was called on a node that was not in the tree" << endl; 
+
+    if (tester.setStateEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m setState passed for a edge test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: setState failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the clear functionality for a normal case" << endl; 
+
+    if (tester.clearNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m clear passed for a normal test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: clear failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the clear functionality for a edge case where the network was already empty" << endl; 
+
+    if (tester.clearEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m clear passed for a edge test"<< endl;
+    } 
+    else {
+        cout << "FAILURE: clear failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test inserting more than 90k satellites into a network with a 64-bit id range." << endl; 
+
+    if (tester.wideIDNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m wide id insertion passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: wide id insertion failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the insertion function for an error case where ids are outside of the custom id range." << endl; 
+
+    if (tester.wideIDError()) {
+        cout << "\033[1;32mSUCCESS\033[0m wide id insertion passed for a error test" << endl;
+    } 
+    else {
+        cout << "FAILURE: wide id insertion failed for a error test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the stats() snapshot for a normal case." << endl; 
+
+    if (tester.statsNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m stats passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: stats failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the stats() snapshot for an edge case where the network is empty." << endl; 
+
+    if (tester.statsEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m stats passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: stats failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the latency histograms for a normal case where every call is timed." << endl; 
+
+    if (tester.latencyNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m latency histograms passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: latency histograms failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the latency histograms for an edge case where the timing is off or sampled." << endl; 
+
+    if (tester.latencyEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m latency histograms passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: latency histograms failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test writing a generated workload to a trace and replaying it." << endl; 
+
+    if (tester.traceNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m trace replay passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: trace replay failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test recording the calls of a live network and replaying the recording." << endl; 
+
+    if (tester.traceEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m trace recording passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: trace recording failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test lazy removal for a normal case where tombstones build up until the tree is rebuilt." << endl; 
+
+    if (tester.lazyRemoveNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m lazy removal passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: lazy removal failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test lazy removal for an edge case where tombstones are purged on demand or by turning it off." << endl; 
+
+    if (tester.lazyRemoveEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m lazy removal passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: lazy removal failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test unionWith and difference for a normal case with overlapping networks." << endl; 
+
+    if (tester.unionDifferenceNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m union and difference passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: union and difference failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test join, split and extractRange for edge cases with empty and disjoint networks." << endl; 
+
+    if (tester.joinSplitEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m join and split passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: join and split failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the parallel unionWith and difference for a normal case against the sequential versions." << endl; 
+
+    if (tester.parallelSetNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m parallel union and difference passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: parallel union and difference failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test satellite handles for a normal case with removals of nodes with two children." << endl; 
+
+    if (tester.handleNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m handles passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: handles failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test satellite handles for edge cases with failed inserts and lazily removed satellites." << endl; 
+
+    if (tester.handleEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m handles passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: handles failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test rank, select and size for a normal case against a sorted list of the ids." << endl; 
+
+    if (tester.orderStatisticNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m order statistics passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: order statistics failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test rank, select and percentile for edge cases with an empty network and out of range arguments." << endl; 
+
+    if (tester.orderStatisticEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m order statistics passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: order statistics failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the asynchronous front end for a normal case with four producer threads." << endl; 
+
+    if (tester.asyncNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m async commands passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: async commands failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the asynchronous front end for edge cases with failing commands and a full ring." << endl; 
+
+    if (tester.asyncEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m async commands passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: async commands failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test background clearing for a normal case with clear, operator= and the destructor." << endl; 
+
+    if (tester.backgroundClearNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m background clear passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: background clear failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test background clearing for edge cases with an empty network and the option off." << endl; 
+
+    if (tester.backgroundClearEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m background clear passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: background clear failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the change stream for a normal case with random changes sent to a replica over a pipe." << endl; 
+
+    if (tester.changeStreamNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m change stream passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: change stream failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the change stream for edge cases where the replica needs a snapshot." << endl; 
+
+    if (tester.changeStreamEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m change stream passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: change stream failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the batched lookup for a normal case with duplicates and tombstones." << endl; 
+
+    if (tester.batchFindNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m batched lookup passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: batched lookup failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the batched lookup for edge cases with empty batches and networks." << endl; 
+
+    if (tester.batchFindEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m batched lookup passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: batched lookup failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the successor index for a normal case with bulk operations." << endl; 
+
+    if (tester.idIndexNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m successor index passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: successor index failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the successor index for edge cases at the ends of the range." << endl; 
+
+    if (tester.idIndexEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m successor index passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: successor index failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the lookup cache for a normal case with skewed lookups." << endl; 
+
+    if (tester.lookupCacheNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m lookup cache passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: lookup cache failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the lookup cache for edge cases where cached satellites are removed." << endl; 
+
+    if (tester.lookupCacheEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m lookup cache passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: lookup cache failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the predicate state update for a normal case of decay processing." << endl; 
+
+    if (tester.updateWhereNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m updateWhere passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: updateWhere failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the predicate removal for edge cases from none to all satellites." << endl; 
+
+    if (tester.removeWhereEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m removeWhere passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: removeWhere failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the shell index for a normal case of a changing network" << endl; 
+
+    if (tester.shellIndexNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m shell index passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: shell index failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the shell index for an edge case of empty shells, id ranges and a wide network" << endl; 
+
+    if (tester.shellIndexEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m shell index passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: shell index failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the mapped network for a normal case of building and reopening a catalog" << endl; 
+
+    if (tester.mappedNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m mapped network passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: mapped network failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the mapped network for an edge case of foreign files, crashes and sync modes" << endl; 
+
+    if (tester.mappedEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m mapped network passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: mapped network failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the fork snapshot for a normal case of a network changing during the snapshot" << endl; 
+
+    if (tester.forkSnapshotNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m fork snapshot passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: fork snapshot failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the fork snapshot for an edge case of empty networks, failures and bad files" << endl; 
+
+    if (tester.forkSnapshotEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m fork snapshot passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: fork snapshot failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the catalog codec for a normal case of dense and sparse catalogs" << endl; 
+
+    if (tester.catalogNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m catalog codec passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: catalog codec failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the catalog codec for an edge case of empty, extreme and broken catalogs" << endl; 
+
+    if (tester.catalogEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m catalog codec passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: catalog codec failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test compact for a normal case of a churned network in both layouts" << endl; 
+
+    if (tester.compactNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m compact passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: compact failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test incremental compact for an edge case of changes between steps and shared blocks" << endl; 
+
+    if (tester.compactEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m incremental compact passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: incremental compact failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test DECAYING deadlines for a normal case of random changes between expiries" << endl; 
+
+    if (tester.expireNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m deadline expiry passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: deadline expiry failed for a normal test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test DECAYING deadlines for an edge case of far and past deadlines and bulk changes" << endl; 
+
+    if (tester.expireEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m deadline expiry passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: deadline expiry failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the catalog codec for an edge case of malformed blocks" << endl; 
+
+    if (tester.catalogMalformedEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m malformed catalog passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: malformed catalog failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the indexes for an edge case of bulk operations that touch one satellite" << endl; 
+
+    if (tester.bulkIndexEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m bulk index passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: bulk index failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the batch driver for an edge case of malformed lines, 64-bit ids and a last line without a newline" << endl; 
+
+    if (tester.batchEdge()) {
+        cout << "\033[1;32mSUCCESS\033[0m batch driver passed for a edge test" << endl;
+    } 
+    else {
+        cout << "FAILURE: batch driver failed for a edge test" << endl;
+    }
+
+    cout << "________________________________________________________" << endl; 
+
+    cout << "Test the generic AvlCatalog for a normal case of a debris catalog over int keys" << endl; 
+
+    if (tester.avlCatalogNormal()) {
+        cout << "\033[1;32mSUCCESS\033[0m avl catalog passed for a normal test" << endl;
+    } 
+    else {
+        cout << "FAILURE: avl catalog failed for a normal test" << endl;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,155 @@
+// Title: protocol.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for protocol.h
+
+#include "protocol.h"
+#include <arpa/inet.h>
+#include <cstring>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Name - requestSize(int op)
+// Desc - every request has a fixed size so a partial one is recognized without parsing it
+int requestSize(int op){
+    switch (op){
+        case REQ_FIND: return 9;
+        case REQ_SETSTATE: return 10;
+        case REQ_INSERT: return 10;
+        case REQ_REMOVE: return 9;
+        case REQ_COUNT: return 2;
+        case REQ_LIST: return 1;
+        case REQ_REMOVEDEORBITED: return 1;
+    }
+    return -1;
+}
+
+// Name - responseSize(int op)
+// Desc - the fixed part of a response
+int responseSize(int op){
+    switch (op){
+        case REQ_COUNT: return 5;
+        case REQ_LIST: return 5;
+    }
+    return 1;
+}
+
+// Name - putID(SatID id, vector<unsigned char>& out)
+// Desc - appends id as 8 little endian bytes
+void putID(SatID id, vector<unsigned char>& out){
+    uint64_t value = id;
+    for (int i = 0; i < 8; i++){
+        out.push_back((value >> (8 * i)) & 0xFF);
+    }
+}
+
+// Name - getID(const unsigned char* data)
+// Desc - reads an id written by putID
+SatID getID(const unsigned char* data){
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++){
+        value |= uint64_t(data[i]) << (8 * i);
+    }
+    return SatID(value);
+}
+
+// Name - putInt(uint32_t value, vector<unsigned char>& out)
+// Desc - appends value as 4 little endian bytes
+void putInt(uint32_t value, vector<unsigned char>& out){
+    for (int i = 0; i < 4; i++){
+        out.push_back((value >> (8 * i)) & 0xFF);
+    }
+}
+
+// Name - getInt(const unsigned char* data)
+// Desc - reads a value written by putInt
+uint32_t getInt(const unsigned char* data){
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (uint32_t(data[3]) << 24);
+}
+
+// Name - packAttributes(ALT alt, INCLIN inclin, STATE state)
+// Desc - the attribute byte of an insert or a LIST entry
+unsigned char packAttributes(ALT alt, INCLIN inclin, STATE state){
+    return alt | (inclin << 2) | (state << 4);
+}
+
+// Name - putRequest(const TraceOp& op, vector<unsigned char>& out)
+// Desc - appends the request that performs a trace operation
+void putRequest(const TraceOp& op, vector<unsigned char>& out){
+    switch (op.op){
+        case T_FIND:
+            out.push_back(REQ_FIND);
+            putID(op.id, out);
+            break;
+        case T_SETSTATE:
+            out.push_back(REQ_SETSTATE);
+            putID(op.id, out);
+            out.push_back(op.state);
+            break;
+        case T_INSERT:
+            out.push_back(REQ_INSERT);
+            putID(op.id, out);
+            out.push_back(packAttributes(op.alt, op.inclin, op.state));
+            break;
+        case T_REMOVE:
+            out.push_back(REQ_REMOVE);
+            putID(op.id, out);
+            break;
+        case T_REMOVEDEORBITED:
+            out.push_back(REQ_REMOVEDEORBITED);
+            break;
+    }
+}
+
+// Name - putCount(REQUEST op, int degree, vector<unsigned char>& out)
+// Desc - appends a COUNT request for an inclination, or a LIST request
+void putCount(REQUEST op, int degree, vector<unsigned char>& out){
+    out.push_back(op);
+    if (op == REQ_COUNT){
+        out.push_back(degree);
+    }
+}
+
+// Name - connectTo(const string& kind, const string& address, int port)
+// Desc - opens a blocking stream socket to a Unix socket path or a TCP host and port
+int connectTo(const string& kind, const string& address, int port){
+    int fd = -1;
+    if (kind == "unix"){
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, address.c_str(), sizeof(addr.sun_path) - 1);
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0){
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* found = nullptr;
+    if (getaddrinfo(address.c_str(), to_string(port).c_str(), &hints, &found) != 0){
+        return -1;
+    }
+    for (addrinfo* entry = found; entry != nullptr && fd < 0; entry = entry->ai_next){
+        fd = socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+        if (fd >= 0 && connect(fd, entry->ai_addr, entry->ai_addrlen) != 0){
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(found);
+    if (fd >= 0){
+        // pipelined windows are written in one go, don't hold them back
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
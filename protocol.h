@@ -0,0 +1,47 @@
+// Title: protocol.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: The binary protocol spoken by the catalog server (server.cpp) and its load generator
+// (loadgen.cpp).
+//
+// A client may send any number of requests without waiting (pipelining), the server answers each
+// connection's requests in order. Every request starts with an opcode byte, ids are 8 byte little
+// endian and the attributes of an insert share one byte like in a trace record (altitude in bits
+// 0-1, inclination in bits 2-3, state in bits 4-5):
+//   FIND id                   -> status
+//   SETSTATE id state         -> status
+//   INSERT id attributes      -> status
+//   REMOVE id                 -> status
+//   COUNT inclination         -> status, count (4 bytes)
+//   LIST                      -> status, n (4 bytes), n times id attributes
+//   REMOVEDEORBITED           -> status
+// The status byte is 1 if the satellite was found, changed or the request succeeded, 0 otherwise.
+// An unknown opcode closes the connection.
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+#include "satnet.h"
+#include "trace.h"
+#include <string>
+#include <vector>
+using namespace std;
+
+enum REQUEST {REQ_FIND, REQ_SETSTATE, REQ_INSERT, REQ_REMOVE, REQ_COUNT, REQ_LIST, REQ_REMOVEDEORBITED};
+const int NUM_REQUESTS = 7;
+const int LIST_ENTRY_SIZE = 9;
+
+// the size of a request with opcode op including the opcode, -1 for an unknown opcode
+int requestSize(int op);
+// the size of the response to op, LIST responses only give the size of their header
+int responseSize(int op);
+// appends the request for a trace operation
+void putRequest(const TraceOp& op, vector<unsigned char>& out);
+void putCount(REQUEST op, int degree, vector<unsigned char>& out);// COUNT or LIST
+void putID(SatID id, vector<unsigned char>& out);
+SatID getID(const unsigned char* data);
+void putInt(uint32_t value, vector<unsigned char>& out);
+uint32_t getInt(const unsigned char* data);
+unsigned char packAttributes(ALT alt, INCLIN inclin, STATE state);
+// connects to "unix <path>" or "tcp <host> <port>" style addresses, -1 on failure
+int connectTo(const string& kind, const string& address, int port);
+#endif
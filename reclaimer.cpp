@@ -0,0 +1,99 @@
+// Title: reclaimer.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for reclaimer.h
+
+#include "reclaimer.h"
+
+// Name - instance()
+// Desc - The reclaimer is allocated once and left running until the process exits, so networks destroyed
+// during static destruction can still use it. Trees still waiting at exit are returned with the process.
+Reclaimer& Reclaimer::instance(){
+    static Reclaimer* reclaimer = new Reclaimer();
+    return *reclaimer;
+}
+
+// Name - Reclaimer()
+// Desc - starts the thread
+Reclaimer::Reclaimer(){
+    m_busy = false;
+    m_pending = 0;
+    m_freed = 0;
+    m_trees = 0;
+    m_thread = thread(&Reclaimer::loop, this);
+    m_thread.detach();
+}
+
+// Name - give(Sat* root, int nodes)
+// Desc - queues a tree for the thread unless that would put the backlog over RECLAIM_LIMIT
+bool Reclaimer::give(Sat* root, int nodes){
+    if (root == nullptr){
+        return true;
+    }
+    if (m_pending.load(memory_order_relaxed) + nodes > RECLAIM_LIMIT){
+        return false;
+    }
+    {
+        lock_guard<mutex> guard(m_lock);
+        m_queue.push_back(root);
+        m_pending.fetch_add(nodes, memory_order_relaxed);
+        m_trees.fetch_add(1, memory_order_relaxed);
+    }
+    m_work.notify_one();
+    return true;
+}
+
+// Name - drain()
+// Desc - blocks until the queue is empty and the thread is idle
+void Reclaimer::drain(){
+    unique_lock<mutex> guard(m_lock);
+    m_idle.wait(guard, [this]{return m_queue.empty() && !m_busy;});
+}
+
+// Name - loop()
+// Desc - frees the queued trees one chunk at a time, the lock is only held to take a tree
+void Reclaimer::loop(){
+    while (true){
+        Sat* root = nullptr;
+        {
+            unique_lock<mutex> guard(m_lock);
+            if (m_queue.empty()){
+                m_idle.notify_all();
+            }
+            m_work.wait(guard, [this]{return !m_queue.empty();});
+            root = m_queue.front();
+            m_queue.pop_front();
+            m_busy = true;
+        }
+        while (root != nullptr){
+            int freed = freeSome(root, RECLAIM_CHUNK);
+            m_pending.fetch_sub(freed, memory_order_relaxed);
+            m_freed.fetch_add(freed, memory_order_relaxed);
+        }
+        lock_guard<mutex> guard(m_lock);
+        m_busy = false;
+    }
+}
+
+// Name - freeSome(Sat*& root, int limit)
+// Desc - A node without a left child is freed and its right child takes its place, otherwise the left
+// child is rotated up. Every node is rotated at most once, so a whole tree takes O(n) without a stack.
+// Returns the number of nodes freed.
+int Reclaimer::freeSome(Sat*& root, int limit){
+    int freed = 0;
+    while (root != nullptr && freed < limit){
+        Sat* left = root->getLeft();
+        if (left == nullptr){
+            Sat* right = root->getRight();
+            NodeSlab::free(root);
+            root = right;
+            freed++;
+        }
+        else {
+            root->setLeft(left->getRight());
+            left->setRight(root);
+            root = left;
+        }
+    }
+    return freed;
+}
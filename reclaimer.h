@@ -0,0 +1,48 @@
+// Title: reclaimer.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: A background thread that frees the trees detached by SatNet::clear() when background
+// clearing is on, so clearing a large network doesn't stall the caller.
+//
+// Trees are freed in chunks of RECLAIM_CHUNK nodes by rotating left children up, which needs no stack
+// and can stop between any two nodes. The backlog is bounded: once RECLAIM_LIMIT nodes are waiting,
+// give() refuses new trees and the caller frees them itself.
+
+#ifndef RECLAIMER_H
+#define RECLAIMER_H
+#include "satnet.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+using namespace std;
+
+const long long RECLAIM_LIMIT = 1 << 22;// nodes waiting to be freed, about 200MB of satellites
+const int RECLAIM_CHUNK = 4096;         // nodes freed between two updates of the counters
+
+class Reclaimer{
+    public:
+    // the process wide reclaimer, started on first use and never destroyed
+    static Reclaimer& instance();
+    // hands over a detached tree of nodes nodes, false if the backlog is full and the caller must free it
+    bool give(Sat* root, int nodes);
+    void drain();// waits until every tree given so far is freed
+    long long getPending() const {return m_pending.load(memory_order_relaxed);}// nodes not freed yet
+    long long getFreed() const {return m_freed.load(memory_order_relaxed);}// nodes freed since the start
+    long long getTrees() const {return m_trees.load(memory_order_relaxed);}// trees handed over since the start
+    private:
+    Reclaimer();
+    void loop();
+    int freeSome(Sat*& root, int limit);// frees up to limit nodes of a tree, root is what is left
+    mutex m_lock;
+    condition_variable m_work;
+    condition_variable m_idle;
+    deque<Sat*> m_queue;    //the detached trees, the front one is being freed
+    bool m_busy;            //true while the thread holds a tree outside the queue
+    atomic<long long> m_pending;
+    atomic<long long> m_freed;
+    atomic<long long> m_trees;
+    thread m_thread;
+};
+#endif
@@ -0,0 +1,133 @@
+// Title: replay.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: Drives SatNet with generated workloads and recorded traces.
+//
+// Usage:
+//   ./replay run <ops> [mix] [keys] [theta]          load keys satellites, then run ops operations
+//   ./replay gen <trace> <ops> [mix] [keys] [theta]  write the same operations to a trace file
+//   ./replay replay <trace> [sample rate]            replay a trace at full speed
+// mix is "find,setState,insert,remove,removeDeorbited" (default 50,30,10,9,1), keys defaults to
+// 50000 and theta, the Zipfian skew of the hot ids, defaults to 0.99. The load phase is part of
+// generated traces so a replay starts from an empty network.
+
+#include "satnet.h"
+#include "trace.h"
+#include "workload.h"
+#include <cstdlib>
+#include <string>
+using namespace std;
+
+const int DEFAULT_KEYS = 50000;
+const double DEFAULT_THETA = 0.99;
+const int DEFAULT_SAMPLE_RATE = 16;
+
+// Name - usage()
+// Desc - prints how to call the driver and returns the exit code for bad arguments
+int usage(){
+    cout << "Usage:" << endl;
+    cout << "  ./replay run <ops> [mix] [keys] [theta]" << endl;
+    cout << "  ./replay gen <trace> <ops> [mix] [keys] [theta]" << endl;
+    cout << "  ./replay replay <trace> [sample rate]" << endl;
+    cout << "  mix is find,setState,insert,remove,removeDeorbited weights, e.g. 50,30,10,9,1" << endl;
+    return 1;
+}
+
+// Name - report(const vector<TraceOp>& ops, long long ns, const SatNet& network)
+// Desc - prints the throughput of a run and the latency histograms of the network
+void report(const vector<TraceOp>& ops, long long ns, const SatNet& network){
+    long long counts[NUM_TRACEOPS] = {0};
+    for (size_t i = 0; i < ops.size(); i++){
+        counts[ops[i].op]++;
+    }
+    cout << ops.size() << " operations in " << ns / 1e6 << " ms, "
+         << (ns > 0 ? ops.size() * 1e9 / ns : 0) << " ops/s" << endl;
+    for (int op = 0; op < NUM_TRACEOPS; op++){
+        cout << "  " << traceOpStr(static_cast<TRACEOP>(op)) << ": " << counts[op] << endl;
+    }
+    cout << network.latency().toText();
+}
+
+// Name - makeWorkload(...)
+// Desc - parses the optional mix, keys and theta arguments starting at argv[first]
+bool makeWorkload(int argc, char* argv[], int first, WorkloadMix& mix, int& keys, double& theta){
+    keys = DEFAULT_KEYS;
+    theta = DEFAULT_THETA;
+    if (argc > first && !mix.parse(argv[first])){
+        cout << "Bad mix: " << argv[first] << endl;
+        return false;
+    }
+    if (argc > first + 1) keys = atoi(argv[first + 1]);
+    if (argc > first + 2) theta = atof(argv[first + 2]);
+    if (keys < 1 || theta <= 0 || theta >= 1){
+        cout << "keys must be positive and theta in (0, 1)" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]){
+    if (argc < 3){
+        return usage();
+    }
+    string command = argv[1];
+    WorkloadMix mix;
+    int keys = 0;
+    double theta = 0;
+
+    if (command == "run"){
+        int count = atoi(argv[2]);
+        if (count < 0 || !makeWorkload(argc, argv, 3, mix, keys, theta)){
+            return usage();
+        }
+        Workload workload(mix, keys, theta);
+        SatNet network(MINID, workload.maxID());
+        vector<TraceOp> ops;
+        workload.load(ops);
+        replayTrace(network, ops);
+        ops.clear();
+        workload.generate(count, ops);
+        network.setLatencySampling(DEFAULT_SAMPLE_RATE);
+        long long ns = replayTrace(network, ops);
+        cout << "mix " << mix.toString() << ", " << keys << " keys, theta " << theta << endl;
+        report(ops, ns, network);
+    }
+    else if (command == "gen"){
+        if (argc < 4){
+            return usage();
+        }
+        int count = atoi(argv[3]);
+        if (count < 0 || !makeWorkload(argc, argv, 4, mix, keys, theta)){
+            return usage();
+        }
+        Workload workload(mix, keys, theta);
+        vector<TraceOp> ops;
+        workload.load(ops);
+        workload.generate(count, ops);
+        if (!writeTrace(argv[2], ops, MINID, workload.maxID())){
+            cout << "Can't write " << argv[2] << endl;
+            return 1;
+        }
+        cout << "Wrote " << ops.size() << " operations to " << argv[2] << endl;
+    }
+    else if (command == "replay"){
+        int sampleRate = DEFAULT_SAMPLE_RATE;
+        if (argc > 3) sampleRate = atoi(argv[3]);
+        vector<TraceOp> ops;
+        SatID minID;
+        SatID maxID;
+        if (!readTrace(argv[2], ops, minID, maxID)){
+            cout << "Can't read the trace " << argv[2] << endl;
+            return 1;
+        }
+        // the range of the recording network, so the calls it rejected are rejected again
+        SatNet network(minID, maxID);
+        network.setLatencySampling(sampleRate);
+        long long ns = replayTrace(network, ops);
+        report(ops, ns, network);
+    }
+    else {
+        return usage();
+    }
+    return 0;
+}
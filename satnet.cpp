@@ -1,430 +1,1979 @@
-// Title: satnet.cpp
-// Author: Andrew Tang
-// Date: 10/22/2023
-// Description: This is the implementation file for satnet.h
-
-#include "satnet.h"
-
-// Name - SatNet()
-// Desc - The constructor performs the required initializations. It creates an empty object.
-SatNet::SatNet(){
-    // set member variable to a null value
-    m_root = nullptr;
-}
-
-// Name - ~SatNet()
-// Desc - The destructor performs the required cleanup including memory deallocations and re-initializing.
-SatNet::~SatNet(){
-    // call clear since the destructor can't be recursively called
-    clear();
-    m_root = nullptr;
-}
-
-// Name - insert(const Sat& satellite)
-// Desc - This function inserts a Sat object into the tree in the proper position. 
-// The Sat::m_id should be used as the key to traverse the SatNet tree and abide by BST traversal rules. 
-// The comparison operators (>, <, ==, !=) work with the int type in C++. A Sat id is a unique number 
-// in the range MINID - MAXID. We do not allow a duplicate id or an object with invalid id in the tree.
-void SatNet::insert(const Sat& satellite){
-    // call overloaded function if the id is valid
-    if (satellite.getID() >= MINID && satellite.getID() <= MAXID){
-        insert(satellite, m_root);
-    }
-}
-
-// Name - insert(const Sat& satellite, Sat*& node)
-// Desc - overloaded function to allow recursion
-void SatNet::insert(const Sat& satellite, Sat*& node) {
-    // base case given that you have reached the end or the "bottom" of the tree 
-    if (node == nullptr) {
-        node = new Sat(satellite.getID(), satellite.getAlt(), satellite.getInclin(), satellite.getState());
-        node->m_height = 0;
-        return;
-    }
-    
-    // based on if greater or less than the current node value, recurse onto the left or right child nodes
-    if (satellite.getID() < node->getID()) {
-        insert(satellite, node->m_left);
-    } 
-    else if (satellite.getID() > node->getID()) {
-        insert(satellite, node->m_right);
-    } else {
-        return;
-    }
-
-    // update the heights and fix the balance
-    updateHeight(node);
-    rebalance(node);
-}
-
-// Name - clear()
-// Desc - The clear function deallocates all memory in the tree and makes it an empty tree.
-void SatNet::clear(){
-    // call overloaded function
-    clear(m_root);
-    m_root = nullptr;
-}
-
-// Name - clear(Sat*& node)
-// Desc - overloaded function to allow recursion
-void SatNet::clear(Sat*& node){
-    // check if the node is populated; if it is, call clear recursively on the left and right
-    if (node) {
-        clear(node->m_left);
-        clear(node->m_right);
-        delete node;
-        node = nullptr;
-    }
-}
-
-// Name - remove(int id)
-// Desc - The remove function traverses the tree to find a node with the id and removes it from the tree.
-void SatNet::remove(int id){
-    // call overloaded
-    remove(id, m_root);
-}
-
-// Name - remove(int id, Sat*& node)
-// Desc - overloaded function to allow recursion
-void SatNet::remove(int id, Sat*& node) {
-    // base case where no node found 
-    if (node == nullptr) {
-        return;
-    }
-    
-    // based on if greater or less than the current node value, recurse onto the left or right child nodes
-    if (id < node->getID()) {
-        remove(id, node->m_left);
-    } 
-    else if (id > node->getID()) {
-        remove(id, node->m_right);
-    } 
-    // case where the node was found
-    else if (id == node->getID()){
-        // case where there are 0 child nodes
-        if (node->m_left == nullptr && node->m_right == nullptr) {
-            delete node;
-            node = nullptr;
-        }
-        // case where there is 1 child node
-        else if (node->m_left == nullptr || node->m_right == nullptr) {
-            Sat* temp = nullptr;
-            // get either the left or right node, depending on which one is populated
-            if (node->m_left != nullptr) {
-                temp = node->m_left;
-            } 
-            if (node->m_right != nullptr) {
-                temp = node->m_right;
-            }
-            // just set the node as its child
-            delete node; 
-            node = temp; 
-        } 
-        else {
-            Sat* successor = node;
-            // go to right subtree
-            successor = successor->m_right; 
-            // find the min value on the right subtree
-            while (successor->m_left != nullptr) {
-                successor = successor->m_left;
-            }
-            node->setID(successor->getID());
-            node->setAlt(successor->getAlt());
-            node->setInclin(successor->getInclin());
-            node->setState(successor->getState());
-
-            // call remove on the successor to handle the case where it has children 
-            remove(successor->getID(), node->m_right);
-        }
-    }
-    // update height and rebalance on tail recursion
-    updateHeight(node);
-    rebalance(node);
-}
-
-// Name - dumpTree()
-// Desc - outputs the contents of the tree
-void SatNet::dumpTree() const {
-    dump(m_root);
-}
-
-// Name - dump(Sat* satellite)
-// Desc - overloaded function to allow recursion
-void SatNet::dump(Sat* satellite) const{
-    if (satellite != nullptr){
-        cout << "(";
-        dump(satellite->m_left);//first visit the left child
-        cout << satellite->m_id << ":" << satellite->m_height;//second visit the node itself
-        dump(satellite->m_right);//third visit the right child
-        cout << ")";
-    }
-}
-
-// Name - listSatellites()
-// Desc - This function prints a list of all satellites in the tree to the standard output in the ascending order of IDs. 
-// The information for every Sat object will be printed in a new line. 
-// For the format of output please refer to the sample output file, i.e. driver.txt.
-void SatNet::listSatellites() const {
-    // call overloaded
-    listSatellites(m_root);
-}
-
-// Name - listSatellites(Sat* node)
-// Desc - overloaded function to allow recursion
-void SatNet::listSatellites(Sat* node) const {
-    if (node == nullptr) {
-        return;
-    }
-    
-    // perform an inorder search
-    listSatellites(node->m_left);
-
-    cout << "\n" << node->getID() << ": " << node->getStateStr() << ": " << node->getInclinStr() << ": " << node->getAltStr();
-
-    listSatellites(node->m_right);
-}
-
-// Name - setState(int id, STATE state)
-// Desc - This function finds the node with id in the tree and sets its Sat::m_state member variable to state. 
-// If the operation is successful, the function returns true otherwise it returns false. For example, when the
-// satellite with id does not exist in the tree the function returns false.
-bool SatNet::setState(int id, STATE state) {
-    return setState(id, state, m_root);
-}
-
-// Name - setState(int id, STATE state, Sat*& node)
-// Desc - overloaded function to allow recursion
-bool SatNet::setState(int id, STATE state, Sat*& node){
-    // basecase where node was not found 
-    if (node == nullptr) {
-        return false;
-    }
-
-    // find the correct node then set the state
-    if (id < node->getID()) {
-        return setState(id, state, node->m_left);
-    } 
-    else if (id > node->getID()) {
-        return setState(id, state, node->m_right);
-    } 
-    else {
-        node->setState(state);
-        return true;
-    }
-}
-
-// Name - removeDeorbited()
-// Desc - This function traverses the tree, finds all satellites with 
-// DEORBITED state and removes them from the tree. The final tree must be a balanced AVL tree.
-void SatNet::removeDeorbited() {
-    removeDeorbited(m_root);
-}
-
-// Name - removeDeorbited(Sat*& node)
-// Desc - overloaded function to allow recursion
-void SatNet::removeDeorbited(Sat*& node) {
-    if (node == nullptr) {
-        return;
-    }
-
-    // recursively go through every possible node then call remove on every "DEORBITED" node
-    removeDeorbited(node->m_left);
-    removeDeorbited(node->m_right);
-
-    if (node->getState() == DEORBITED) {
-        remove(node->getID(), node);
-    }
-}
-
-// Name - findSatellite(int id)
-// Desc - This function returns true if it finds the node with id in the tree, otherwise it returns false.
-bool SatNet::findSatellite(int id) const {
-    return findSatellite(m_root, id);
-}
-
-// Name - findSatellite(const Sat* node, int id) 
-// Desc - overloaded function to allow recursion
-bool SatNet::findSatellite(const Sat* node, int id) const {
-    // base case where not found
-    if (node == nullptr) {
-        return false;
-    }
-    // base case where the satellite was found
-    if (node->getID() == id) {
-        return true;
-    }
-
-    // look for the node
-    if (id < node->getID()) {
-        return findSatellite(node->m_left, id);
-    }
-    else {
-        return findSatellite(node->m_right, id);
-    }
-}
-
-// Name - operator=(const SatNet & rhs)
-// Desc - This function overloads the assignment operator for the class SatNet. 
-// It creates an exact deep copy of the rhs.
-const SatNet & SatNet::operator=(const SatNet & rhs){
-    // check if lhs is the rhs
-    if (this == &rhs) {
-        return *this;
-    }
-    // clear out the tree
-    clear(m_root);
-    
-    // call the copy operation
-    m_root = copy(rhs.m_root);
-    return *this;
-}
-
-// Name - copy(const Sat* node)
-// Desc - overloaded function to allow recursion
-Sat* SatNet::copy(const Sat* node) const {
-    // base case
-    if (node == nullptr) {
-        return nullptr;
-    }
-
-    // copy the node's data
-    Sat* newNode = new Sat(node->getID(), node->getAlt(), node->getInclin(), node->getState());
-    // set the height variables
-    newNode->m_height = node->m_height;
-    // set the children of that node by recursively calling the copy function
-    newNode->m_left = copy(node->m_left);
-    newNode->m_right = copy(node->m_right);
-
-    return newNode;
-}
-
-// Name - countSatellites(INCLIN degree)
-// Desc - This function traverses the tree, finds all satellites with the inclination specified by 
-// degree variable and returns the total number of satellites with that inclination in the network.
-int SatNet::countSatellites(INCLIN degree) const {
-    return countSatellites(m_root, degree);
-}
-
-// Name - countSatellites(Sat* node, INCLIN degree)
-// Desc - overloaded function to allow recursion
-int SatNet::countSatellites(Sat* node, INCLIN degree) const {
-    // base case
-    if (node == nullptr) {
-        return 0;
-    }
-
-    int count = 0;
-    // if the incline is the same, then increment the counter
-    if (node->getInclin() == degree) {
-        count++;
-    }
-
-    // recursive call on left and right children 
-    count += countSatellites(node->m_left, degree);
-    count += countSatellites(node->m_right, degree);
-
-    return count;
-}
-
-// Name - rightRotate(Sat*& node)
-// Desc - perform a right rotate on the node
-void SatNet::rightRotate(Sat*& node) {
-    // perform the right rotate by switching pointers
-    Sat* newRoot = node->m_left;
-    node->m_left = newRoot->m_right;
-    newRoot->m_right = node;
-    node = newRoot;
-
-    // update heights 
-    updateHeight(node->m_right);
-    updateHeight(node);
-}
-
-// Name - leftRotate(Sat*& node)
-// Desc - perform a left rotate on the node
-void SatNet::leftRotate(Sat*& node) {
-    // perform a left rotate by swtcihing pointers
-    Sat* newRoot = node->m_right;
-    node->m_right = newRoot->m_left;
-    newRoot->m_left = node;
-    node = newRoot;
-
-    // update heights
-    updateHeight(node->m_left);
-    updateHeight(node);
-}
-
-// Name - updateHeight(Sat*& node)
-// Desc - defines the height based on the child nodes
-void SatNet::updateHeight(Sat*& node) {
-    if (node == nullptr){
-        return; 
-    }
-    // get the height of the left node
-    int leftHeight = -1;
-    if (node->m_left != nullptr) {
-        leftHeight = node->m_left->m_height;
-    }
-
-    // get the height of the right node
-    int rightHeight = -1;
-    if (node->m_right != nullptr) {
-        rightHeight = node->m_right->m_height;
-    }
-
-    // set the new heights based on whichever child height was greater
-    node->m_height = 1;
-    if (leftHeight > rightHeight) {
-        node->m_height += leftHeight;
-    } 
-    else {
-        node->m_height += rightHeight;
-    }   
-}
-
-// Name - getBalance(Sat* node) 
-// Desc - finds the balance factor of a given node
-int SatNet::getBalance(Sat* node) {
-    if (node == nullptr){
-        return 0; 
-    }
-
-    // get the height of the left child
-    int leftHeight = -1;
-    if (node->m_left != nullptr) {
-        leftHeight = node->m_left->m_height;
-    }
-    
-    // get the height of the right child 
-    int rightHeight = -1;
-    if (node->m_right != nullptr) {
-        rightHeight = node->m_right->m_height;
-    }
-    // return the difference
-    return leftHeight - rightHeight; 
-}
-
-// Name - rebalance(Sat*& node)
-// Desc - rebalances the tree depending on the balance factor
-void SatNet::rebalance(Sat*& node) {
-    int balance = getBalance(node);
-
-    // based on what balance is, perform these operations for all cases
-    if (balance > 1) {
-        if (getBalance(node->m_left) >= 0) {
-            rightRotate(node);
-        } 
-        else {
-            leftRotate(node->m_left);
-            rightRotate(node);
-        }
-    } else if (balance < -1) {
-        if (getBalance(node->m_right) <= 0) {
-            leftRotate(node);
-        } 
-        else {
-            rightRotate(node->m_right);
-            leftRotate(node);
-        }
-    }
-}
+// Title: satnet.cpp
+// Author: Andrew Tang
+// Date: 10/22/2023
+// Description: This is the implementation file for satnet.h
+
+#include "satnet.h"
+#include "trace.h"
+#include "taskpool.h"
+#include "reclaimer.h"
+#include "cdc.h"
+#include <algorithm>
+#include <cmath>
+#include <new>
+
+// Name - traceCall(TraceWriter* writer, TRACEOP op, SatID id, ALT alt, INCLIN inclin, STATE state)
+// Desc - writes a public call to the trace if one is being recorded
+static void traceCall(TraceWriter* writer, TRACEOP op, SatID id = DEFAULT_ID, ALT alt = DEFAULT_ALT,
+                      INCLIN inclin = DEFAULT_INCLIN, STATE state = DEFAULT_STATE){
+    if (writer != nullptr){
+        TraceOp call;
+        call.op = op;
+        call.id = id;
+        call.alt = alt;
+        call.inclin = inclin;
+        call.state = state;
+        writer->write(call);
+    }
+}
+
+// Name - logChange(ChangeLog* log, TRACEOP op, SatID id, ALT alt, INCLIN inclin, STATE state)
+// Desc - appends a change the network made to the change log if one is being recorded
+static void logChange(ChangeLog* log, TRACEOP op, SatID id, ALT alt = DEFAULT_ALT, INCLIN inclin = DEFAULT_INCLIN,
+                      STATE state = DEFAULT_STATE){
+    if (log != nullptr){
+        TraceOp change;
+        change.op = op;
+        change.id = id;
+        change.alt = alt;
+        change.inclin = inclin;
+        change.state = state;
+        log->append(change);
+    }
+}
+
+// Name - SatNet()
+// Desc - The constructor performs the required initializations. It creates an empty object.
+SatNet::SatNet(){
+    // set member variable to a null value
+    m_root = nullptr;
+    m_minID = MINID;
+    m_maxID = MAXID;
+    m_trace = nullptr;
+    m_changes = nullptr;
+    m_lazy = false;
+    m_backgroundClear = false;
+    m_compactFraction = DEFAULT_COMPACT_FRACTION;
+    m_nodes = 0;
+    m_tombstones = 0;
+    m_index.setRange(m_minID, m_maxID);
+    m_shells.setRange(m_minID, m_maxID);
+    m_compactSlab = nullptr;
+    m_compactNext = 0;
+    m_deferChanges = false;
+    m_bulkLogged = 0;
+}
+
+// Name - SatNet(SatID minID, SatID maxID)
+// Desc - Creates an empty object that accepts ids in the range minID - maxID.
+// If the range is reversed the bounds are swapped.
+SatNet::SatNet(SatID minID, SatID maxID){
+    m_root = nullptr;
+    m_minID = minID;
+    m_maxID = maxID;
+    m_trace = nullptr;
+    m_changes = nullptr;
+    m_lazy = false;
+    m_backgroundClear = false;
+    m_compactFraction = DEFAULT_COMPACT_FRACTION;
+    m_nodes = 0;
+    m_tombstones = 0;
+    if (m_minID > m_maxID) {
+        m_minID = maxID;
+        m_maxID = minID;
+    }
+    m_index.setRange(m_minID, m_maxID);
+    m_shells.setRange(m_minID, m_maxID);
+    m_compactSlab = nullptr;
+    m_compactNext = 0;
+    m_deferChanges = false;
+    m_bulkLogged = 0;
+}
+
+// Name - ~SatNet()
+// Desc - The destructor performs the required cleanup including memory deallocations and re-initializing.
+SatNet::~SatNet(){
+    // a network going away isn't a change to replicate, and the log may already be gone
+    m_changes = nullptr;
+    // call clear since the destructor can't be recursively called
+    clear();
+    m_root = nullptr;
+}
+
+// Name - insert(const Sat& satellite)
+// Desc - This function inserts a Sat object into the tree in the proper position. 
+// The Sat::m_id should be used as the key to traverse the SatNet tree and abide by BST traversal rules. 
+// The comparison operators (>, <, ==, !=) work with the SatID type in C++. A Sat id is a unique number 
+// in the range of the network (MINID - MAXID by default). We do not allow a duplicate id or an object with invalid id in the tree.
+// Returns a handle to the inserted satellite, or nullptr if nothing was inserted.
+SatHandle SatNet::insert(const Sat& satellite){
+    LatencyTimer timer(m_latency.get(), OP_INSERT);
+    traceCall(m_trace, T_INSERT, satellite.getID(), satellite.getAlt(), satellite.getInclin(), satellite.getState());
+    // call overloaded function if the id is valid
+    if (satellite.getID() >= m_minID && satellite.getID() <= m_maxID){
+        SATNET_COUNT(descents[OP_INSERT], 1);
+        Sat* inserted = insert(satellite, m_root);
+        if (inserted != nullptr) {
+            indexNode(inserted);
+            logChange(m_changes, T_INSERT, inserted->getID(), inserted->getAlt(), inserted->getInclin(), inserted->getState());
+        }
+        return inserted;
+    }
+    return nullptr;
+}
+
+// Name - insert(const Sat& satellite, Sat*& node)
+// Desc - overloaded function to allow recursion, returns the new node or nullptr for a duplicate
+Sat* SatNet::insert(const Sat& satellite, Sat*& node) {
+    // base case given that you have reached the end or the "bottom" of the tree 
+    if (node == nullptr) {
+        node = allocNode(satellite.getID(), satellite.getAlt(), satellite.getInclin(), satellite.getState());
+        node->m_height = 0;
+        return node;
+    }
+    SATNET_COUNT(descentDepth[OP_INSERT], 1);
+    Sat* inserted = nullptr;
+    
+    // based on if greater or less than the current node value, recurse onto the left or right child nodes
+    if (satellite.getID() < node->getID()) {
+        SATNET_COUNT(comparisons, 1);
+        inserted = insert(satellite, node->m_left);
+    } 
+    else if (satellite.getID() > node->getID()) {
+        SATNET_COUNT(comparisons, 2);
+        inserted = insert(satellite, node->m_right);
+    } else {
+        SATNET_COUNT(comparisons, 2);
+        // a tombstone with the same id is brought back with the new data
+        if (node->m_deleted) {
+            node->setAlt(satellite.getAlt());
+            node->setInclin(satellite.getInclin());
+            node->setState(satellite.getState());
+            node->m_deleted = false;
+            m_tombstones--;
+            updateHeight(node);
+            return node;
+        }
+        return nullptr;
+    }
+
+    // update the heights and fix the balance
+    updateHeight(node);
+    rebalance(node);
+    return inserted;
+}
+
+// Name - clear()
+// Desc - The clear function deallocates all memory in the tree and makes it an empty tree.
+void SatNet::clear(){
+    LatencyTimer timer(m_latency.get(), OP_CLEAR);
+    release();
+}
+
+// Name - release()
+// Desc - Empties the tree for clear and operator=. With background clearing the whole tree is handed
+// to the reclaimer in O(1), unless its backlog is full, otherwise the nodes are freed here. A network
+// of up to MAX_LOGGED_BULK satellites logs each removal, a larger one invalidates the change log.
+void SatNet::release(){
+    bool empty = m_root == nullptr;
+    if (!empty && m_changes != nullptr && size() <= MAX_LOGGED_BULK) {
+        logLive(m_root, true);
+    }
+    else if (!empty) {
+        invalidateChanges();
+    }
+    m_cache.clear();
+    endCompact();
+    if (m_backgroundClear && m_root != nullptr && Reclaimer::instance().give(m_root, m_nodes)) {
+        SATNET_COUNT(frees, m_nodes);
+        m_nodes = 0;
+    }
+    else {
+        // call overloaded function
+        clear(m_root);
+    }
+    // an empty tree has nothing indexed, so clearing an empty network doesn't touch the bitmaps
+    if (!empty) {
+        m_index.clear();
+        m_shells.clear();
+    }
+    m_root = nullptr;
+    m_tombstones = 0;
+    m_deadlines.clear();
+}
+
+// Name - clear(Sat*& node)
+// Desc - overloaded function to allow recursion
+void SatNet::clear(Sat*& node){
+    // check if the node is populated; if it is, call clear recursively on the left and right
+    if (node) {
+        clear(node->m_left);
+        clear(node->m_right);
+        freeNode(node);
+        node = nullptr;
+    }
+}
+
+// Name - remove(SatID id)
+// Desc - The remove function traverses the tree to find a node with the id and removes it from the tree.
+void SatNet::remove(SatID id){
+    LatencyTimer timer(m_latency.get(), OP_REMOVE);
+    traceCall(m_trace, T_REMOVE, id);
+    // call overloaded
+    SATNET_COUNT(descents[OP_REMOVE], 1);
+    if (m_lazy) {
+        // only mark the node, the tree is rebuilt once there are too many tombstones
+        if (markRemoved(id)) {
+            logChange(m_changes, T_REMOVE, id);
+            if (m_tombstones > m_compactFraction * m_nodes) {
+                purgeTombstones();
+            }
+        }
+        return;
+    }
+    int live = size();
+    remove(id, m_root);
+    if (size() < live) {
+        logChange(m_changes, T_REMOVE, id);
+    }
+}
+
+// Name - remove(SatID id, Sat*& node)
+// Desc - overloaded function to allow recursion
+void SatNet::remove(SatID id, Sat*& node) {
+    // base case where no node found 
+    if (node == nullptr) {
+        return;
+    }
+    SATNET_COUNT(descentDepth[OP_REMOVE], 1);
+    
+    // based on if greater or less than the current node value, recurse onto the left or right child nodes
+    if (id < node->getID()) {
+        SATNET_COUNT(comparisons, 1);
+        remove(id, node->m_left);
+    } 
+    else if (id > node->getID()) {
+        SATNET_COUNT(comparisons, 2);
+        remove(id, node->m_right);
+    } 
+    // case where the node was found
+    else if (id == node->getID()){
+        SATNET_COUNT(comparisons, 3);
+        if (node->m_deleted) {
+            m_tombstones--;
+        }
+        else {
+            unindexNode(node);
+        }
+        // case where there are 0 child nodes
+        if (node->m_left == nullptr && node->m_right == nullptr) {
+            freeNode(node);
+            node = nullptr;
+        }
+        // case where there is 1 child node
+        else if (node->m_left == nullptr || node->m_right == nullptr) {
+            Sat* temp = nullptr;
+            // get either the left or right node, depending on which one is populated
+            if (node->m_left != nullptr) {
+                temp = node->m_left;
+            } 
+            if (node->m_right != nullptr) {
+                temp = node->m_right;
+            }
+            // just set the node as its child
+            freeNode(node); 
+            node = temp; 
+        } 
+        else {
+            // unlink the successor, the min of the right subtree, and relink it in place of the node
+            // instead of copying its data over, so every other satellite keeps its address
+            Sat* successor = splitMin(node->m_right);
+            successor->m_left = node->m_left;
+            successor->m_right = node->m_right;
+            freeNode(node);
+            node = successor;
+        }
+    }
+    // update height and rebalance on tail recursion
+    updateHeight(node);
+    rebalance(node);
+}
+
+// Name - dumpTree()
+// Desc - outputs the contents of the tree
+void SatNet::dumpTree() const {
+    dump(m_root);
+}
+
+// Name - dump(Sat* satellite)
+// Desc - overloaded function to allow recursion
+void SatNet::dump(Sat* satellite) const{
+    if (satellite != nullptr){
+        cout << "(";
+        dump(satellite->m_left);//first visit the left child
+        cout << satellite->m_id << ":" << satellite->m_height;//second visit the node itself
+        dump(satellite->m_right);//third visit the right child
+        cout << ")";
+    }
+}
+
+// Name - listSatellites()
+// Desc - This function prints a list of all satellites in the tree to the standard output in the ascending order of IDs. 
+// The information for every Sat object will be printed in a new line. 
+// For the format of output please refer to the sample output file, i.e. driver.txt.
+void SatNet::listSatellites() const {
+    // call overloaded
+    listSatellites(m_root);
+}
+
+// Name - listSatellites(Sat* node)
+// Desc - overloaded function to allow recursion
+void SatNet::listSatellites(Sat* node) const {
+    if (node == nullptr) {
+        return;
+    }
+    
+    // perform an inorder search, tombstones are skipped
+    listSatellites(node->m_left);
+
+    if (!node->m_deleted) {
+        cout << "\n" << node->getID() << ": " << node->getStateStr() << ": " << node->getInclinStr() << ": " << node->getAltStr();
+    }
+
+    listSatellites(node->m_right);
+}
+
+// Name - setState(SatID id, STATE state)
+// Desc - This function finds the node with id in the tree and sets its Sat::m_state member variable to state. 
+// If the operation is successful, the function returns true otherwise it returns false. For example, when the
+// satellite with id does not exist in the tree the function returns false.
+bool SatNet::setState(SatID id, STATE state) {
+    LatencyTimer timer(m_latency.get(), OP_SETSTATE);
+    traceCall(m_trace, T_SETSTATE, id, DEFAULT_ALT, DEFAULT_INCLIN, state);
+    if (m_cache.isEnabled()) {
+        Sat* node = m_cache.probe(id);
+        if (node == nullptr) {
+            node = findNode(id, OP_SETSTATE);
+        }
+        if (node == nullptr || node->m_deleted) {
+            return false;
+        }
+        node->setState(state);
+    }
+    else {
+        SATNET_COUNT(descents[OP_SETSTATE], 1);
+        if (!setState(id, state, m_root)) {
+            return false;
+        }
+    }
+    if (!m_deadlines.empty()) {
+        m_deadlines.cancel(id);
+    }
+    logChange(m_changes, T_SETSTATE, id, DEFAULT_ALT, DEFAULT_INCLIN, state);
+    return true;
+}
+
+// Name - setState(SatID id, STATE state, long long deadline)
+// Desc - sets the state like setState(id, state) and schedules the deadline if the state is DECAYING
+bool SatNet::setState(SatID id, STATE state, long long deadline) {
+    if (!setState(id, state)) {
+        return false;
+    }
+    if (state == DECAYING) {
+        m_deadlines.schedule(id, deadline);
+    }
+    return true;
+}
+
+// Name - setState(SatHandle handle, STATE state)
+// Desc - Sets the state of the satellite a handle points to without searching the tree. The handle must
+// belong to this network. Returns false for nullptr and for a satellite that was removed lazily.
+bool SatNet::setState(SatHandle handle, STATE state) {
+    LatencyTimer timer(m_latency.get(), OP_SETSTATE);
+    if (handle == nullptr) {
+        return false;
+    }
+    traceCall(m_trace, T_SETSTATE, handle->getID(), DEFAULT_ALT, DEFAULT_INCLIN, state);
+    if (handle->m_deleted) {
+        return false;
+    }
+    // the network owns its nodes, the handle is only const for the callers
+    const_cast<Sat*>(handle)->setState(state);
+    if (!m_deadlines.empty()) {
+        m_deadlines.cancel(handle->getID());
+    }
+    logChange(m_changes, T_SETSTATE, handle->getID(), DEFAULT_ALT, DEFAULT_INCLIN, state);
+    return true;
+}
+
+// Name - setState(SatID id, STATE state, Sat*& node)
+// Desc - overloaded function to allow recursion
+bool SatNet::setState(SatID id, STATE state, Sat*& node){
+    // basecase where node was not found 
+    if (node == nullptr) {
+        return false;
+    }
+    SATNET_COUNT(descentDepth[OP_SETSTATE], 1);
+
+    // find the correct node then set the state
+    if (id < node->getID()) {
+        SATNET_COUNT(comparisons, 1);
+        return setState(id, state, node->m_left);
+    } 
+    else if (id > node->getID()) {
+        SATNET_COUNT(comparisons, 2);
+        return setState(id, state, node->m_right);
+    } 
+    else {
+        SATNET_COUNT(comparisons, 2);
+        if (node->m_deleted) {
+            return false;
+        }
+        node->setState(state);
+        return true;
+    }
+}
+
+// Name - removeDeorbited()
+// Desc - This function traverses the tree, finds all satellites with 
+// DEORBITED state and removes them from the tree. The final tree must be a balanced AVL tree.
+void SatNet::removeDeorbited() {
+    LatencyTimer timer(m_latency.get(), OP_REMOVEDEORBITED);
+    traceCall(m_trace, T_REMOVEDEORBITED);
+    if (m_lazy) {
+        markDeorbited(m_root);
+        if (m_tombstones > m_compactFraction * m_nodes) {
+            purgeTombstones();
+        }
+        return;
+    }
+    removeDeorbited(m_root);
+}
+
+// Name - removeDeorbited(Sat*& node)
+// Desc - overloaded function to allow recursion. The deorbited ids are collected first and then removed
+// one at a time from the root, removing them during the traversal would leave the ancestors of the
+// removed nodes with stale heights and could unbalance the tree by more than one rotation can fix.
+void SatNet::removeDeorbited(Sat*& node) {
+    vector<SatID> ids;
+    collectDeorbited(node, ids);
+    for (size_t i = 0; i < ids.size(); i++) {
+        remove(ids[i], node);
+        logChange(m_changes, T_REMOVE, ids[i]);
+    }
+}
+
+// Name - expireDecaying(long long now, bool purge)
+// Desc - Advances the deadline wheel to now and moves the satellites it returns to DEORBITED. A
+// satellite that isn't DECAYING anymore would have lost its deadline, the check only guards the update.
+int SatNet::expireDecaying(long long now, bool purge) {
+    vector<SatID> expired;
+    m_deadlines.advance(now, expired);
+    int moved = 0;
+    for (size_t i = 0; i < expired.size(); i++) {
+        Sat** link = findLink(expired[i]);
+        Sat* node = link == nullptr ? nullptr : *link;
+        if (node != nullptr && !node->m_deleted && node->getState() == DECAYING) {
+            node->setState(DEORBITED);
+            traceCall(m_trace, T_SETSTATE, expired[i], DEFAULT_ALT, DEFAULT_INCLIN, DEORBITED);
+            logChange(m_changes, T_SETSTATE, expired[i], DEFAULT_ALT, DEFAULT_INCLIN, DEORBITED);
+            moved++;
+        }
+    }
+    if (purge && moved > 0) {
+        removeDeorbited();
+    }
+    return moved;
+}
+
+// Name - finishUpdate(const vector<SatID>& ids, STATE state)
+// Desc - traces and logs the state changes made by updateWhere as setState calls
+void SatNet::finishUpdate(const vector<SatID>& ids, STATE state) {
+    for (size_t i = 0; i < ids.size(); i++) {
+        if (!m_deadlines.empty()) {
+            m_deadlines.cancel(ids[i]);
+        }
+        traceCall(m_trace, T_SETSTATE, ids[i], DEFAULT_ALT, DEFAULT_INCLIN, state);
+        logChange(m_changes, T_SETSTATE, ids[i], DEFAULT_ALT, DEFAULT_INCLIN, state);
+    }
+}
+
+// Name - finishRemove(const vector<Sat*>& nodes)
+// Desc - Removes the tombstones removeWhere marked. With lazy removal they stay until the next compaction.
+// Otherwise removing them one at a time costs O(k log n) and rebuilding the tree without them O(n), so
+// the tree is rebuilt when k log n is larger.
+void SatNet::finishRemove(const vector<Sat*>& nodes) {
+    m_tombstones += nodes.size();
+    vector<SatID> ids(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ids[i] = nodes[i]->getID();
+        unindexNode(nodes[i]);
+        traceCall(m_trace, T_REMOVE, ids[i]);
+        logChange(m_changes, T_REMOVE, ids[i]);
+    }
+    if (m_lazy) {
+        if (m_tombstones > m_compactFraction * m_nodes) {
+            purgeTombstones();
+        }
+        return;
+    }
+    if (ids.size() * log2(m_nodes + 1.0) > m_nodes) {
+        purgeTombstones();
+        return;
+    }
+    for (size_t i = 0; i < ids.size(); i++) {
+        remove(ids[i], m_root);
+    }
+}
+
+// Name - forkJoin(TaskPool& pool, const function<void()>& first, const function<void()>& second)
+// Desc - runs both on the pool, kept here so satnet.h doesn't need the pool's definition for the templates
+void SatNet::forkJoin(TaskPool& pool, const function<void()>& first, const function<void()>& second) {
+    pool.forkJoin(first, second);
+}
+
+// Name - collectDeorbited(const Sat* node, vector<SatID>& ids)
+// Desc - adds the ids of all deorbited satellites in the subtree to ids
+void SatNet::collectDeorbited(const Sat* node, vector<SatID>& ids) const {
+    if (node == nullptr) {
+        return;
+    }
+    collectDeorbited(node->m_left, ids);
+    if (node->getState() == DEORBITED && !node->m_deleted) {
+        ids.push_back(node->getID());
+    }
+    collectDeorbited(node->m_right, ids);
+}
+
+// Name - findSatellite(SatID id)
+// Desc - This function returns true if it finds the node with id in the tree, otherwise it returns false.
+bool SatNet::findSatellite(SatID id) const {
+    LatencyTimer timer(m_latency.get(), OP_FIND);
+    traceCall(m_trace, T_FIND, id);
+    if (m_cache.isEnabled()) {
+        const Sat* node = m_cache.probe(id);
+        if (node == nullptr) {
+            node = findNode(id, OP_FIND);
+        }
+        return node != nullptr && !node->m_deleted;
+    }
+    SATNET_COUNT(descents[OP_FIND], 1);
+    return findSatellite(m_root, id);
+}
+
+// Name - findSatellite(const Sat* node, SatID id) 
+// Desc - overloaded function to allow recursion
+bool SatNet::findSatellite(const Sat* node, SatID id) const {
+    // base case where not found
+    if (node == nullptr) {
+        return false;
+    }
+    SATNET_COUNT(descentDepth[OP_FIND], 1);
+    // base case where the satellite was found, a tombstone is not a satellite
+    SATNET_COUNT(comparisons, 1);
+    if (node->getID() == id) {
+        return !node->m_deleted;
+    }
+
+    // look for the node
+    SATNET_COUNT(comparisons, 1);
+    if (id < node->getID()) {
+        return findSatellite(node->m_left, id);
+    }
+    else {
+        return findSatellite(node->m_right, id);
+    }
+}
+
+// Name - operator=(const SatNet & rhs)
+// Desc - This function overloads the assignment operator for the class SatNet. 
+// It creates an exact deep copy of the rhs.
+const SatNet & SatNet::operator=(const SatNet & rhs){
+    LatencyTimer timer(m_latency.get(), OP_ASSIGN);
+    // check if lhs is the rhs
+    if (this == &rhs) {
+        return *this;
+    }
+    // clear out the tree
+    release();
+    
+    // call the copy operation, the id range and the tombstones are part of the copy
+    setRange(rhs.m_minID, rhs.m_maxID);
+    m_root = copy(rhs.m_root);
+    m_lazy = rhs.m_lazy;
+    m_compactFraction = rhs.m_compactFraction;
+    m_tombstones = rhs.m_tombstones;
+    indexLive(m_root);
+    if (m_root != nullptr && m_changes != nullptr && size() <= MAX_LOGGED_BULK) {
+        logLive(m_root, false);
+    }
+    else if (m_root != nullptr) {
+        invalidateChanges();
+    }
+    return *this;
+}
+
+// Name - copy(const Sat* node)
+// Desc - overloaded function to allow recursion
+Sat* SatNet::copy(const Sat* node) {
+    // base case
+    if (node == nullptr) {
+        return nullptr;
+    }
+
+    // copy the node's data
+    Sat* newNode = allocNode(node->getID(), node->getAlt(), node->getInclin(), node->getState());
+    // set the height and tombstone variables
+    newNode->m_height = node->m_height;
+    newNode->m_size = node->m_size;
+    newNode->m_deleted = node->m_deleted;
+    // set the children of that node by recursively calling the copy function
+    newNode->m_left = copy(node->m_left);
+    newNode->m_right = copy(node->m_right);
+
+    return newNode;
+}
+
+// Name - countSatellites(INCLIN degree)
+// Desc - This function traverses the tree, finds all satellites with the inclination specified by 
+// degree variable and returns the total number of satellites with that inclination in the network.
+int SatNet::countSatellites(INCLIN degree) const {
+    LatencyTimer timer(m_latency.get(), OP_COUNT);
+    return countSatellites(m_root, degree);
+}
+
+// Name - countSatellites(Sat* node, INCLIN degree)
+// Desc - overloaded function to allow recursion
+int SatNet::countSatellites(Sat* node, INCLIN degree) const {
+    // base case
+    if (node == nullptr) {
+        return 0;
+    }
+
+    int count = 0;
+    // if the incline is the same, then increment the counter
+    if (node->getInclin() == degree && !node->m_deleted) {
+        count++;
+    }
+
+    // recursive call on left and right children 
+    count += countSatellites(node->m_left, degree);
+    count += countSatellites(node->m_right, degree);
+
+    return count;
+}
+
+// Name - allocNode(SatID id, ALT alt, INCLIN inclin, STATE state)
+// Desc - allocates a new leaf node, every node of the tree is created here
+Sat* SatNet::allocNode(SatID id, ALT alt, INCLIN inclin, STATE state) {
+    SATNET_COUNT(allocations, 1);
+    m_nodes++;
+    return new Sat(id, alt, inclin, state);
+}
+
+// Name - freeNode(Sat* node)
+// Desc - deallocates a node, every node of the tree is deleted here
+void SatNet::freeNode(Sat* node) {
+    SATNET_COUNT(frees, 1);
+    m_nodes--;
+    if (m_cache.isEnabled()) {
+        m_cache.forget(node);
+    }
+    NodeSlab::free(node);
+}
+
+// Name - stats()
+// Desc - returns a snapshot of the operation counters together with the node count, height,
+// average depth and memory used by the tree. The shape is measured with an O(n) traversal.
+SatStats SatNet::stats() const {
+    SatStats result;
+#ifdef SATNET_STATS
+    result.comparisons = m_counters.comparisons.load(memory_order_relaxed);
+    result.leftRotations = m_hooks.leftRotations.load(memory_order_relaxed);
+    result.rightRotations = m_hooks.rightRotations.load(memory_order_relaxed);
+    result.doubleRotations = m_hooks.doubleRotations.load(memory_order_relaxed);
+    result.allocations = m_counters.allocations.load(memory_order_relaxed);
+    result.frees = m_counters.frees.load(memory_order_relaxed);
+    for (int op = 0; op < NUM_SATOPS; op++) {
+        result.descents[op] = m_counters.descents[op].load(memory_order_relaxed);
+        result.descentDepth[op] = m_counters.descentDepth[op].load(memory_order_relaxed);
+    }
+#endif
+    // the average depth is accumulated as a sum of depths first
+    shape(m_root, 0, result);
+    result.tombstones = m_tombstones;
+    if (m_root != nullptr) {
+        result.height = m_root->m_height;
+        result.averageDepth /= result.nodeCount;
+    }
+    result.bytesUsed = sizeof(SatNet) + (long long)result.nodeCount * sizeof(Sat) +
+                       (m_latency != nullptr ? sizeof(LatencyRecorder) : 0);
+    return result;
+}
+
+// Name - shape(const Sat* node, int depth, SatStats& result)
+// Desc - overloaded function to allow recursion, counts the nodes and sums up their depths
+void SatNet::shape(const Sat* node, int depth, SatStats& result) const {
+    if (node == nullptr) {
+        return;
+    }
+    result.nodeCount++;
+    result.averageDepth += depth;
+    shape(node->m_left, depth + 1, result);
+    shape(node->m_right, depth + 1, result);
+}
+
+// Name - resetStats()
+// Desc - sets all the operation counters back to 0
+void SatNet::resetStats() {
+#ifdef SATNET_STATS
+    m_counters.comparisons.store(0, memory_order_relaxed);
+    m_hooks.leftRotations.store(0, memory_order_relaxed);
+    m_hooks.rightRotations.store(0, memory_order_relaxed);
+    m_hooks.doubleRotations.store(0, memory_order_relaxed);
+    m_counters.allocations.store(0, memory_order_relaxed);
+    m_counters.frees.store(0, memory_order_relaxed);
+    for (int op = 0; op < NUM_SATOPS; op++) {
+        m_counters.descents[op].store(0, memory_order_relaxed);
+        m_counters.descentDepth[op].store(0, memory_order_relaxed);
+    }
+#endif
+    m_cache.resetCounts();
+}
+
+// Name - setLatencySampling(int sampleRate)
+// Desc - turns the latency histograms on for 1 of every sampleRate calls of each public operation,
+// 0 turns them off. The histograms are read through latency().
+void SatNet::setLatencySampling(int sampleRate) {
+    if (m_latency == nullptr && sampleRate > 0) {
+        m_latency.reset(new LatencyRecorder());
+    }
+    if (m_latency != nullptr) {
+        m_latency->setSampleRate(sampleRate);
+    }
+}
+
+// Name - latency()
+// Desc - the latency histograms, empty ones if the timing was never turned on
+const LatencyRecorder& SatNet::latency() const {
+    static const LatencyRecorder off;
+    return m_latency != nullptr ? *m_latency : off;
+}
+
+// Name - setLazyRemove(bool lazy, double compactFraction)
+// Desc - Turns lazy removal on or off. With lazy removal, remove and removeDeorbited only mark the nodes
+// as tombstones in O(log n) and the tree is rebuilt without them once more than compactFraction of the
+// nodes are tombstones. Turning lazy removal off purges the remaining tombstones.
+void SatNet::setLazyRemove(bool lazy, double compactFraction) {
+    m_lazy = lazy;
+    if (compactFraction <= 0 || compactFraction > 1) {
+        compactFraction = DEFAULT_COMPACT_FRACTION;
+    }
+    m_compactFraction = compactFraction;
+    if (!m_lazy && m_tombstones > 0) {
+        purgeTombstones();
+    }
+}
+
+// Name - markRemoved(SatID id)
+// Desc - finds the node with id and marks it as a tombstone, returns true if a live node was marked
+bool SatNet::markRemoved(SatID id) {
+    Sat* node = m_root;
+    while (node != nullptr) {
+        SATNET_COUNT(descentDepth[OP_REMOVE], 1);
+        if (id < node->getID()) {
+            SATNET_COUNT(comparisons, 1);
+            node = node->m_left;
+        }
+        else if (id > node->getID()) {
+            SATNET_COUNT(comparisons, 2);
+            node = node->m_right;
+        }
+        else {
+            SATNET_COUNT(comparisons, 2);
+            if (node->m_deleted) {
+                return false;
+            }
+            node->m_deleted = true;
+            m_tombstones++;
+            unindexNode(node);
+            break;
+        }
+    }
+    if (node == nullptr) {
+        return false;
+    }
+    // walk the path again, the node and its ancestors lose one live satellite
+    Sat* target = node;
+    node = m_root;
+    while (node != target) {
+        node->m_size--;
+        node = (id < node->getID()) ? node->m_left : node->m_right;
+    }
+    target->m_size--;
+    return true;
+}
+
+// Name - markDeorbited(Sat* node)
+// Desc - marks every live deorbited node in the subtree as a tombstone
+void SatNet::markDeorbited(Sat* node) {
+    if (node == nullptr) {
+        return;
+    }
+    markDeorbited(node->m_left);
+    if (node->getState() == DEORBITED && !node->m_deleted) {
+        node->m_deleted = true;
+        m_tombstones++;
+        unindexNode(node);
+        logChange(m_changes, T_REMOVE, node->getID());
+    }
+    markDeorbited(node->m_right);
+    updateHeight(node);
+}
+
+// Name - purgeTombstones()
+// Desc - Frees all tombstones and rebuilds a perfectly balanced tree out of the live nodes in O(n).
+// The live nodes are relinked, not copied.
+void SatNet::purgeTombstones() {
+    if (m_tombstones == 0) {
+        return;
+    }
+    vector<Sat*> nodes;
+    nodes.reserve(m_nodes - m_tombstones);
+    collectLive(m_root, nodes);
+    m_tombstones = 0;
+    m_root = build(nodes, 0, (int)nodes.size() - 1);
+}
+
+// Name - collectLive(Sat* node, vector<Sat*>& nodes)
+// Desc - adds the live nodes of the subtree to nodes in ascending order and frees the tombstones
+void SatNet::collectLive(Sat* node, vector<Sat*>& nodes) {
+    if (node == nullptr) {
+        return;
+    }
+    Sat* right = node->m_right;
+    collectLive(node->m_left, nodes);
+    if (node->m_deleted) {
+        freeNode(node);
+    }
+    else {
+        nodes.push_back(node);
+    }
+    collectLive(right, nodes);
+}
+
+// Name - build(vector<Sat*>& nodes, int low, int high)
+// Desc - links nodes[low..high], which are in ascending order, into a balanced tree and returns its root
+Sat* SatNet::build(vector<Sat*>& nodes, int low, int high) {
+    if (low > high) {
+        return nullptr;
+    }
+    int middle = low + (high - low) / 2;
+    Sat* node = nodes[middle];
+    node->m_left = build(nodes, low, middle - 1);
+    node->m_right = build(nodes, middle + 1, high);
+    updateHeight(node);
+    return node;
+}
+
+// Name - compact(LAYOUT layout)
+// Desc - Copies every node into a new slab in layout order in O(n). The old nodes are first used to
+// forward to their copies, so the copies' links are rewritten without a map, and then freed.
+void SatNet::compact(LAYOUT layout) {
+    endCompact();
+    vector<Sat*> nodes;
+    nodes.reserve(m_nodes);
+    this->layout(layout, nodes);
+    if (nodes.empty()) {
+        return;
+    }
+    NodeSlab* slab = NodeSlab::create(nodes.size());
+    for (Sat* node : nodes) {
+        node->m_left = slab->place(*node);
+    }
+    // every copy still links to old nodes, which now point at their copies
+    for (Sat* node : nodes) {
+        Sat* moved = node->m_left;
+        if (moved->m_left != nullptr) {
+            moved->m_left = moved->m_left->m_left;
+        }
+        if (moved->m_right != nullptr) {
+            moved->m_right = moved->m_right->m_left;
+        }
+    }
+    m_root = m_root->m_left;
+    for (Sat* node : nodes) {
+        NodeSlab::free(node);
+    }
+    slab->seal();
+    m_cache.clear();
+}
+
+// Name - beginCompact(LAYOUT layout)
+// Desc - records the ids in layout order and the slab compactStep moves them into, a running
+// incremental compact is ended first
+void SatNet::beginCompact(LAYOUT layout) {
+    endCompact();
+    vector<Sat*> nodes;
+    nodes.reserve(m_nodes);
+    this->layout(layout, nodes);
+    if (nodes.empty()) {
+        return;
+    }
+    m_compactOrder.reserve(nodes.size());
+    for (const Sat* node : nodes) {
+        m_compactOrder.push_back(node->getID());
+    }
+    m_compactSlab = NodeSlab::create(nodes.size());
+}
+
+// Name - compactStep(int maxNodes)
+// Desc - Moves the next maxNodes ids of the recorded order into the slab, each with one descent that
+// finds the link pointing at it. Ids that were removed since beginCompact are skipped but still count
+// toward maxNodes so a step is bounded. Returns true when nothing is left to move.
+bool SatNet::compactStep(int maxNodes) {
+    for (int i = 0; m_compactSlab != nullptr && i < maxNodes && m_compactNext < m_compactOrder.size(); i++) {
+        Sat** link = findLink(m_compactOrder[m_compactNext++]);
+        if (link != nullptr) {
+            Sat* node = *link;
+            *link = m_compactSlab->place(*node);
+            if (m_cache.isEnabled()) {
+                m_cache.forget(node);
+            }
+            NodeSlab::free(node);
+        }
+    }
+    if (m_compactNext >= m_compactOrder.size()) {
+        endCompact();
+    }
+    return m_compactSlab == nullptr;
+}
+
+// Name - endCompact()
+// Desc - stops an incremental compact, the nodes already moved stay in its slab
+void SatNet::endCompact() {
+    if (m_compactSlab != nullptr) {
+        m_compactSlab->seal();
+        m_compactSlab = nullptr;
+    }
+    vector<SatID>().swap(m_compactOrder);
+    m_compactNext = 0;
+}
+
+// Name - layout(LAYOUT order, vector<Sat*>& nodes)
+// Desc - appends every node of the tree, tombstones included, in the order compact places them
+void SatNet::layout(LAYOUT order, vector<Sat*>& nodes) const {
+    if (m_root == nullptr) {
+        return;
+    }
+    if (order == LAYOUT_VEB) {
+        layoutVEB(m_root, m_root->m_height + 1, nodes);
+        return;
+    }
+    // breadth first, nodes doubles as the queue
+    nodes.push_back(m_root);
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i]->m_left != nullptr) {
+            nodes.push_back(nodes[i]->m_left);
+        }
+        if (nodes[i]->m_right != nullptr) {
+            nodes.push_back(nodes[i]->m_right);
+        }
+    }
+}
+
+// Name - layoutVEB(Sat* node, int levels, vector<Sat*>& nodes) const
+// Desc - Overloaded function to allow recursion, appends the top levels of the subtree in van Emde Boas
+// order: the top half of the levels recursively, then each subtree hanging below it recursively. A
+// descent then crosses O(log n / log B) blocks of B nodes for every block size B at once.
+void SatNet::layoutVEB(Sat* node, int levels, vector<Sat*>& nodes) const {
+    if (node == nullptr || levels <= 0) {
+        return;
+    }
+    if (levels == 1) {
+        nodes.push_back(node);
+        return;
+    }
+    int top = levels / 2;
+    layoutVEB(node, top, nodes);
+    layoutBottoms(node, top, levels - top, nodes);
+}
+
+// Name - layoutBottoms(Sat* node, int depth, int levels, vector<Sat*>& nodes) const
+// Desc - lays out the subtrees depth levels below node from left to right, levels levels each
+void SatNet::layoutBottoms(Sat* node, int depth, int levels, vector<Sat*>& nodes) const {
+    if (node == nullptr) {
+        return;
+    }
+    if (depth == 0) {
+        layoutVEB(node, levels, nodes);
+        return;
+    }
+    layoutBottoms(node->m_left, depth - 1, levels, nodes);
+    layoutBottoms(node->m_right, depth - 1, levels, nodes);
+}
+
+// Name - findLink(SatID id)
+// Desc - the child pointer or root pointer that points at the node with id, tombstones included,
+// nullptr if the id isn't in the tree
+Sat** SatNet::findLink(SatID id) {
+    Sat** link = &m_root;
+    while (*link != nullptr && (*link)->getID() != id) {
+        link = (id < (*link)->getID()) ? &(*link)->m_left : &(*link)->m_right;
+    }
+    return *link == nullptr ? nullptr : link;
+}
+
+// Name - join(Sat* left, Sat* middle, Sat* right)
+// Desc - Links two balanced trees and a single node into one balanced tree. Every id in left must be
+// smaller than middle's id and every id in right larger. Runs in O(|height(left) - height(right)|).
+Sat* SatNet::join(Sat* left, Sat* middle, Sat* right) {
+    if (height(left) > height(right) + 1) {
+        return joinRight(left, middle, right);
+    }
+    if (height(right) > height(left) + 1) {
+        return joinLeft(left, middle, right);
+    }
+    middle->m_left = left;
+    middle->m_right = right;
+    updateHeight(middle);
+    return middle;
+}
+
+// Name - joinRight(Sat* left, Sat* middle, Sat* right)
+// Desc - left is the taller tree, walk down its right spine to a subtree of about right's height,
+// hang middle there and rebalance on the way back up
+Sat* SatNet::joinRight(Sat* left, Sat* middle, Sat* right) {
+    if (height(left) <= height(right) + 1) {
+        middle->m_left = left;
+        middle->m_right = right;
+        updateHeight(middle);
+        return middle;
+    }
+    left->m_right = joinRight(left->m_right, middle, right);
+    updateHeight(left);
+    rebalance(left);
+    return left;
+}
+
+// Name - joinLeft(Sat* left, Sat* middle, Sat* right)
+// Desc - the mirror image of joinRight for a taller right tree
+Sat* SatNet::joinLeft(Sat* left, Sat* middle, Sat* right) {
+    if (height(right) <= height(left) + 1) {
+        middle->m_left = left;
+        middle->m_right = right;
+        updateHeight(middle);
+        return middle;
+    }
+    right->m_left = joinLeft(left, middle, right->m_left);
+    updateHeight(right);
+    rebalance(right);
+    return right;
+}
+
+// Name - splitMin(Sat*& node)
+// Desc - unlinks the node with the smallest id from a subtree, rebalances it and returns that node
+Sat* SatNet::splitMin(Sat*& node) {
+    if (node->m_left == nullptr) {
+        Sat* min = node;
+        node = node->m_right;
+        min->m_right = nullptr;
+        updateHeight(min);
+        return min;
+    }
+    Sat* min = splitMin(node->m_left);
+    updateHeight(node);
+    rebalance(node);
+    return min;
+}
+
+// Name - join2(Sat* left, Sat* right)
+// Desc - joins two trees without a middle node by borrowing the smallest node of right
+Sat* SatNet::join2(Sat* left, Sat* right) {
+    if (right == nullptr) {
+        return left;
+    }
+    Sat* middle = splitMin(right);
+    return join(left, middle, right);
+}
+
+// Name - split(Sat* node, SatID id, Sat*& left, Sat*& found, Sat*& right)
+// Desc - Splits a tree into the ids smaller than id, the node with id if there is one and the ids larger
+// than id. Each level joins the detached side back, which adds up to O(log n).
+void SatNet::split(Sat* node, SatID id, Sat*& left, Sat*& found, Sat*& right) {
+    if (node == nullptr) {
+        left = nullptr;
+        found = nullptr;
+        right = nullptr;
+        return;
+    }
+    Sat* nodeLeft = node->m_left;
+    Sat* nodeRight = node->m_right;
+    node->m_left = nullptr;
+    node->m_right = nullptr;
+    if (id < node->getID()) {
+        Sat* rest = nullptr;
+        split(nodeLeft, id, left, found, rest);
+        right = join(rest, node, nodeRight);
+    }
+    else if (id > node->getID()) {
+        Sat* rest = nullptr;
+        split(nodeRight, id, rest, found, right);
+        left = join(nodeLeft, node, rest);
+    }
+    else {
+        left = nodeLeft;
+        right = nodeRight;
+        updateHeight(node);
+        found = node;
+    }
+}
+
+// Name - unionWith(Sat* node, const Sat* other)
+// Desc - Overloaded function to allow recursion. Splits node by the root of other, merges the halves
+// with other's subtrees and joins them back around other's root. Tombstones and out of range ids of
+// other are skipped. Every node of other is visited, O(m log(n/m + 2)) for m = |other| and n = |node|.
+Sat* SatNet::unionWith(Sat* node, const Sat* other) {
+    if (other == nullptr) {
+        return node;
+    }
+    Sat* left = nullptr;
+    Sat* found = nullptr;
+    Sat* right = nullptr;
+    split(node, other->getID(), left, found, right);
+    left = unionWith(left, other->m_left);
+    right = unionWith(right, other->m_right);
+    return unionRoot(left, found, right, other);
+}
+
+// Name - unionRoot(Sat* left, Sat* found, Sat* right, const Sat* other)
+// Desc - joins the merged halves of a union around other's root, found is the node that had its id
+Sat* SatNet::unionRoot(Sat* left, Sat* found, Sat* right, const Sat* other) {
+    if (other->m_deleted || other->getID() < m_minID || other->getID() > m_maxID) {
+        if (found == nullptr) {
+            return join2(left, right);
+        }
+    }
+    else if (found == nullptr) {
+        found = allocNode(other->getID(), other->getAlt(), other->getInclin(), other->getState());
+        noteChange(nullptr, found);
+    }
+    else if (found->getAlt() != other->getAlt() || found->getInclin() != other->getInclin() ||
+             found->getState() != other->getState()) {
+        Sat before(found->getID(), found->getAlt(), found->getInclin(), found->getState());
+        noteChange(&before, other);
+        found->setAlt(other->getAlt());
+        found->setInclin(other->getInclin());
+        found->setState(other->getState());
+    }
+    return join(left, found, right);
+}
+
+// Name - difference(Sat* node, const Sat* other)
+// Desc - overloaded function to allow recursion, the same divide and conquer as unionWith but the node
+// matching other's root is freed. Tombstones of other don't remove anything.
+Sat* SatNet::difference(Sat* node, const Sat* other) {
+    if (node == nullptr || other == nullptr) {
+        return node;
+    }
+    Sat* left = nullptr;
+    Sat* found = nullptr;
+    Sat* right = nullptr;
+    split(node, other->getID(), left, found, right);
+    left = difference(left, other->m_left);
+    right = difference(right, other->m_right);
+    return differenceRoot(left, found, right, other);
+}
+
+// Name - differenceRoot(Sat* left, Sat* found, Sat* right, const Sat* other)
+// Desc - joins the halves of a difference back together, freeing found unless other's root is a tombstone
+Sat* SatNet::differenceRoot(Sat* left, Sat* found, Sat* right, const Sat* other) {
+    if (found != nullptr && other->m_deleted) {
+        return join(left, found, right);
+    }
+    if (found != nullptr) {
+        noteChange(found, nullptr);
+        freeNode(found);
+    }
+    return join2(left, right);
+}
+
+// Name - moveIn(SatNet& from, const Sat* node)
+// Desc - Notes every satellite of a subtree that is moving from from into this network, so both
+// networks' indexes are updated and from forgets the nodes, O(k). Returns the number of nodes.
+int SatNet::moveIn(SatNet& from, const Sat* node) {
+    if (node == nullptr) {
+        return 0;
+    }
+    int nodes = moveIn(from, node->m_left);
+    if (!node->m_deleted) {
+        from.noteChange(node, nullptr);
+        noteChange(nullptr, node);
+    }
+    if (from.m_cache.isEnabled()) {
+        from.m_cache.forget(node);
+    }
+    return nodes + 1 + moveIn(from, node->m_right);
+}
+
+// Name - adopt(SatNet& from, Sat* root, int nodes)
+// Desc - makes this network own a tree of nodes nodes that used to belong to from, the nodes that
+// moved were already noted with moveIn
+void SatNet::adopt(SatNet& from, Sat* root, int nodes) {
+    m_root = root;
+    m_nodes += nodes;
+    from.m_nodes -= nodes;
+}
+
+// Name - join(SatNet& rhs)
+// Desc - Moves every satellite of rhs into this network and leaves rhs empty. When all of rhs's ids are
+// larger than this network's ids (or all smaller) the trees are concatenated in O(log n) and the m
+// satellites of rhs are moved between the indexes in O(m), otherwise the satellites are merged with unionWith.
+void SatNet::join(SatNet& rhs) {
+    if (this == &rhs || rhs.m_root == nullptr) {
+        return;
+    }
+    purgeTombstones();
+    rhs.purgeTombstones();
+    if (rhs.m_root == nullptr) {
+        return;
+    }
+    m_bulkLogged = 0;
+    rhs.m_bulkLogged = 0;
+    // out of range ids of rhs must be dropped, which only unionWith does
+    bool inRange = rhs.m_minID >= m_minID && rhs.m_maxID <= m_maxID;
+    Sat* rhsRoot = rhs.m_root;
+    if (inRange && m_root == nullptr) {
+        rhs.m_root = nullptr;
+        adopt(rhs, rhsRoot, moveIn(rhs, rhsRoot));
+        return;
+    }
+    // the smallest and largest node of both trees
+    Sat* lowest = m_root;
+    Sat* highest = m_root;
+    Sat* rhsLowest = rhs.m_root;
+    Sat* rhsHighest = rhs.m_root;
+    while (lowest->m_left != nullptr) lowest = lowest->m_left;
+    while (highest->m_right != nullptr) highest = highest->m_right;
+    while (rhsLowest->m_left != nullptr) rhsLowest = rhsLowest->m_left;
+    while (rhsHighest->m_right != nullptr) rhsHighest = rhsHighest->m_right;
+    if (inRange && highest->getID() < rhsLowest->getID()) {
+        int nodes = moveIn(rhs, rhsRoot);
+        Sat* right = rhsRoot;
+        Sat* middle = splitMin(right);
+        rhs.m_root = nullptr;
+        adopt(rhs, join(m_root, middle, right), nodes);
+        return;
+    }
+    if (inRange && rhsHighest->getID() < lowest->getID()) {
+        int nodes = moveIn(rhs, rhsRoot);
+        Sat* right = m_root;
+        Sat* middle = splitMin(right);
+        rhs.m_root = nullptr;
+        adopt(rhs, join(rhsRoot, middle, right), nodes);
+        return;
+    }
+    unionWith(rhs);
+    rhs.clear();
+}
+
+// Name - split(SatID id, SatNet& right)
+// Desc - moves the satellites with ids >= id into right, this network keeps the smaller ids
+void SatNet::split(SatID id, SatNet& right) {
+    extractRange(id, m_maxID, right);
+}
+
+// Name - unionWith(const SatNet& rhs)
+// Desc - Adds every satellite of rhs to this network, satellites with an id that is already in the
+// network take rhs's data. rhs is not changed. O(m log(n/m + 2)) for m = |rhs| and n = |this|, so never
+// less than O(m) since every satellite of rhs is visited and the new ones are copied, even when rhs is
+// the larger network. Tombstones in this network are purged first, which adds O(n).
+void SatNet::unionWith(const SatNet& rhs) {
+    if (this == &rhs) {
+        return;
+    }
+    purgeTombstones();
+    m_bulkLogged = 0;
+    m_root = unionWith(m_root, rhs.m_root);
+}
+
+// Name - difference(const SatNet& rhs)
+// Desc - Removes every satellite whose id is in rhs. rhs is not changed. O(m log(n/m + 1)) for m the
+// smaller and n the larger network, a subtree of rhs is skipped once no ids of this network are left
+// for it. Tombstones in this network are purged first, which adds O(n).
+void SatNet::difference(const SatNet& rhs) {
+    if (this == &rhs) {
+        clear();
+        return;
+    }
+    purgeTombstones();
+    m_bulkLogged = 0;
+    m_root = difference(m_root, rhs.m_root);
+}
+
+// Name - extractRange(SatID low, SatID high, SatNet& dest)
+// Desc - Moves the satellites with ids in [low, high] into dest, replacing what dest held. dest takes
+// this network's id range. Two splits and a join, O(log n) plus the k satellites that move between
+// the indexes, plus emptying dest if it wasn't empty.
+void SatNet::extractRange(SatID low, SatID high, SatNet& dest) {
+    if (this == &dest) {
+        return;
+    }
+    dest.clear();
+    dest.setRange(m_minID, m_maxID);
+    if (low > high) {
+        return;
+    }
+    purgeTombstones();
+    m_bulkLogged = 0;
+    dest.m_bulkLogged = 0;
+    Sat* left = nullptr;
+    Sat* lowNode = nullptr;
+    Sat* rest = nullptr;
+    split(m_root, low, left, lowNode, rest);
+    Sat* middle = nullptr;
+    Sat* highNode = nullptr;
+    Sat* right = nullptr;
+    split(rest, high, middle, highNode, right);
+    if (lowNode != nullptr) {
+        middle = join(nullptr, lowNode, middle);
+    }
+    if (highNode != nullptr && highNode != lowNode) {
+        middle = join(middle, highNode, nullptr);
+    }
+    m_root = join2(left, right);
+    dest.adopt(*this, middle, dest.moveIn(*this, middle));
+}
+
+// Name - unionWith(Sat* node, const Sat* other, TaskPool& pool)
+// Desc - Overloaded function to allow recursion. The parallel version of unionWith: after the split
+// both halves are merged as parallel tasks. Each task works through its own empty network so the
+// node count and the counters are never shared, the parent adds them up after the join. Subtrees
+// of other at most PARALLEL_CUTOFF high are merged sequentially.
+Sat* SatNet::unionWith(Sat* node, const Sat* other, TaskPool& pool) {
+    if (other == nullptr || other->m_height <= PARALLEL_CUTOFF) {
+        return unionWith(node, other);
+    }
+    Sat* left = nullptr;
+    Sat* found = nullptr;
+    Sat* right = nullptr;
+    split(node, other->getID(), left, found, right);
+    SatNet leftPart(m_minID, m_maxID);
+    SatNet rightPart(m_minID, m_maxID);
+    leftPart.m_deferChanges = true;
+    rightPart.m_deferChanges = true;
+    pool.forkJoin([&] {left = leftPart.unionWith(left, other->m_left, pool);},
+                  [&] {right = rightPart.unionWith(right, other->m_right, pool);});
+    absorb(leftPart);
+    absorb(rightPart);
+    return unionRoot(left, found, right, other);
+}
+
+// Name - difference(Sat* node, const Sat* other, TaskPool& pool)
+// Desc - overloaded function to allow recursion, the parallel version of difference with the same
+// task structure as the parallel unionWith
+Sat* SatNet::difference(Sat* node, const Sat* other, TaskPool& pool) {
+    if (node == nullptr || other == nullptr || other->m_height <= PARALLEL_CUTOFF) {
+        return difference(node, other);
+    }
+    Sat* left = nullptr;
+    Sat* found = nullptr;
+    Sat* right = nullptr;
+    split(node, other->getID(), left, found, right);
+    SatNet leftPart(m_minID, m_maxID);
+    SatNet rightPart(m_minID, m_maxID);
+    leftPart.m_deferChanges = true;
+    rightPart.m_deferChanges = true;
+    pool.forkJoin([&] {left = leftPart.difference(left, other->m_left, pool);},
+                  [&] {right = rightPart.difference(right, other->m_right, pool);});
+    absorb(leftPart);
+    absorb(rightPart);
+    return differenceRoot(left, found, right, other);
+}
+
+// Name - absorb(const SatNet& part)
+// Desc - adds the node count change, the changes and the counters of a network used by a parallel task
+void SatNet::absorb(const SatNet& part) {
+    m_nodes += part.m_nodes;
+    for (size_t i = 0; i < part.m_deferred.size(); i++) {
+        const Change& change = part.m_deferred[i];
+        noteChange(change.hasBefore ? &change.before : nullptr, change.hasAfter ? &change.after : nullptr);
+    }
+#ifdef SATNET_STATS
+    SATNET_COUNT(comparisons, part.m_counters.comparisons.load(memory_order_relaxed));
+    m_hooks.leftRotations.fetch_add(part.m_hooks.leftRotations.load(memory_order_relaxed), memory_order_relaxed);
+    m_hooks.rightRotations.fetch_add(part.m_hooks.rightRotations.load(memory_order_relaxed), memory_order_relaxed);
+    m_hooks.doubleRotations.fetch_add(part.m_hooks.doubleRotations.load(memory_order_relaxed), memory_order_relaxed);
+    SATNET_COUNT(allocations, part.m_counters.allocations.load(memory_order_relaxed));
+    SATNET_COUNT(frees, part.m_counters.frees.load(memory_order_relaxed));
+#endif
+}
+
+// Name - unionWith(const SatNet& rhs, TaskPool& pool)
+// Desc - the same result as unionWith(rhs) computed with the threads of pool
+void SatNet::unionWith(const SatNet& rhs, TaskPool& pool) {
+    if (this == &rhs) {
+        return;
+    }
+    purgeTombstones();
+    m_bulkLogged = 0;
+    m_root = unionWith(m_root, rhs.m_root, pool);
+}
+
+// Name - difference(const SatNet& rhs, TaskPool& pool)
+// Desc - the same result as difference(rhs) computed with the threads of pool
+void SatNet::difference(const SatNet& rhs, TaskPool& pool) {
+    if (this == &rhs) {
+        clear();
+        return;
+    }
+    purgeTombstones();
+    m_bulkLogged = 0;
+    m_root = difference(m_root, rhs.m_root, pool);
+    // the tasks' networks freed nodes without this network's cache forgetting them
+    m_cache.clear();
+}
+
+// Name - rank(SatID id)
+// Desc - Counts the live satellites with an id smaller than id by adding up the left subtrees passed on
+// the way down. Tombstones are skipped. id doesn't need to be in the tree.
+int SatNet::rank(SatID id) const {
+    int smaller = 0;
+    Sat* node = m_root;
+    while (node != nullptr) {
+        if (id <= node->getID()) {
+            node = node->m_left;
+        }
+        else {
+            smaller += size(node->m_left) + (node->m_deleted ? 0 : 1);
+            node = node->m_right;
+        }
+    }
+    return smaller;
+}
+
+// Name - select(int k)
+// Desc - finds the live satellite with the k-th smallest id, select(0) is the smallest and
+// select(size() - 1) the largest. Returns nullptr if k is out of range.
+SatHandle SatNet::select(int k) const {
+    if (k < 0 || k >= size(m_root)) {
+        return nullptr;
+    }
+    Sat* node = m_root;
+    while (node != nullptr) {
+        int leftSize = size(node->m_left);
+        if (k < leftSize) {
+            node = node->m_left;
+        }
+        else if (k == leftSize && !node->m_deleted) {
+            return node;
+        }
+        else {
+            k -= leftSize + (node->m_deleted ? 0 : 1);
+            node = node->m_right;
+        }
+    }
+    return nullptr;
+}
+
+// Name - percentile(double p)
+// Desc - the satellite at the nearest rank p-th percentile by id, e.g. percentile(50) is the median.
+// p is clamped to [0, 100], nullptr for an empty network.
+SatHandle SatNet::percentile(double p) const {
+    int count = size(m_root);
+    if (count == 0) {
+        return nullptr;
+    }
+    p = p < 0 ? 0 : (p > 100 ? 100 : p);
+    int k = (int)ceil(p / 100 * count) - 1;
+    return select(k < 0 ? 0 : k);
+}
+
+// Name - invalidateChanges()
+// Desc - tells the change log about a bulk change too large to log satellite by satellite
+void SatNet::invalidateChanges() {
+    if (m_changes != nullptr) {
+        m_changes->invalidate();
+    }
+}
+
+// Name - getSatellites(vector<Sat>& satellites)
+// Desc - appends a copy of every satellite to satellites in ascending order of ids, tombstones are skipped
+void SatNet::getSatellites(vector<Sat>& satellites) const {
+    satellites.reserve(satellites.size() + size());
+    getSatellites(m_root, satellites);
+}
+
+// Name - getSatellites(const Sat* node, vector<Sat>& satellites)
+// Desc - overloaded function to allow recursion
+void SatNet::getSatellites(const Sat* node, vector<Sat>& satellites) const {
+    if (node == nullptr) {
+        return;
+    }
+    getSatellites(node->m_left, satellites);
+    if (!node->m_deleted) {
+        satellites.push_back(Sat(node->getID(), node->getAlt(), node->getInclin(), node->getState()));
+    }
+    getSatellites(node->m_right, satellites);
+}
+
+// Name - findSatellites(const vector<SatID>& ids, vector<bool>& found)
+// Desc - Batched findSatellite. The sorted ids are split at every node into the ones that go left,
+// the ones equal to the node and the ones that go right, so each node is visited at most once no
+// matter how many ids pass through it. Each id is traced as a find.
+void SatNet::findSatellites(const vector<SatID>& ids, vector<bool>& found) const {
+    LatencyTimer timer(m_latency.get(), OP_FIND);
+    found.assign(ids.size(), false);
+    SATNET_COUNT(descents[OP_FIND], ids.size());
+    for (size_t i = 0; m_trace != nullptr && i < ids.size(); i++) {
+        traceCall(m_trace, T_FIND, ids[i]);
+    }
+    findSatellites(m_root, ids, 0, (int)ids.size(), found);
+}
+
+// Name - findSatellites(const Sat* node, const vector<SatID>& ids, int low, int high, vector<bool>& found)
+// Desc - overloaded function to allow recursion, looks up ids[low..high - 1] in the subtree
+void SatNet::findSatellites(const Sat* node, const vector<SatID>& ids, int low, int high, vector<bool>& found) const {
+    if (node == nullptr || low >= high) {
+        return;
+    }
+    SATNET_COUNT(descentDepth[OP_FIND], 1);
+    int equal = lower_bound(ids.begin() + low, ids.begin() + high, node->getID()) - ids.begin();
+    int greater = upper_bound(ids.begin() + equal, ids.begin() + high, node->getID()) - ids.begin();
+    for (int i = equal; i < greater; i++) {
+        found[i] = !node->m_deleted;
+    }
+    findSatellites(node->m_left, ids, low, equal, found);
+    findSatellites(node->m_right, ids, greater, high, found);
+}
+
+// Name - setRange(SatID minID, SatID maxID)
+// Desc - gives an empty network the id range minID - maxID, the indexes are only reset if it changed
+void SatNet::setRange(SatID minID, SatID maxID) {
+    if (minID == m_minID && maxID == m_maxID) {
+        return;
+    }
+    m_minID = minID;
+    m_maxID = maxID;
+    m_index.setRange(m_minID, m_maxID);
+    m_shells.setRange(m_minID, m_maxID);
+}
+
+// Name - noteChange(const Sat* before, const Sat* after)
+// Desc - Brings the indexes and the deadlines in line with one satellite a bulk operation changed.
+// before is its old data or nullptr if it was added, after its new data or nullptr if it was removed.
+// The networks of parallel tasks keep the change for the parent's absorb instead.
+void SatNet::noteChange(const Sat* before, const Sat* after) {
+    if (m_deferChanges) {
+        Change change;
+        change.hasBefore = before != nullptr;
+        change.hasAfter = after != nullptr;
+        if (before != nullptr) {
+            change.before = Sat(before->getID(), before->getAlt(), before->getInclin(), before->getState());
+        }
+        if (after != nullptr) {
+            change.after = Sat(after->getID(), after->getAlt(), after->getInclin(), after->getState());
+        }
+        m_deferred.push_back(change);
+        return;
+    }
+    if (before != nullptr) {
+        unindexNode(before);
+    }
+    if (after != nullptr) {
+        indexNode(after);
+    }
+    logBulk(before, after);
+}
+
+// Name - logBulk(const Sat* before, const Sat* after)
+// Desc - Logs a change noted by a bulk operation: an added satellite is an insert, a removed one a
+// remove, new data a state change or a remove and an insert if the shell changed. Once the operation
+// would log more than MAX_LOGGED_BULK changes the log is invalidated and the rest isn't logged.
+void SatNet::logBulk(const Sat* before, const Sat* after) {
+    if (m_changes == nullptr || m_bulkLogged > MAX_LOGGED_BULK) {
+        return;
+    }
+    bool stateOnly = before != nullptr && after != nullptr && before->getAlt() == after->getAlt() &&
+                     before->getInclin() == after->getInclin();
+    int changes = stateOnly ? 1 : (before != nullptr) + (after != nullptr);
+    if (m_bulkLogged + changes > MAX_LOGGED_BULK) {
+        invalidateChanges();
+        m_bulkLogged = MAX_LOGGED_BULK + 1;
+        return;
+    }
+    m_bulkLogged += changes;
+    if (stateOnly) {
+        logChange(m_changes, T_SETSTATE, after->getID(), DEFAULT_ALT, DEFAULT_INCLIN, after->getState());
+        return;
+    }
+    if (before != nullptr) {
+        logChange(m_changes, T_REMOVE, before->getID());
+    }
+    if (after != nullptr) {
+        logChange(m_changes, T_INSERT, after->getID(), after->getAlt(), after->getInclin(), after->getState());
+    }
+}
+
+// Name - logLive(const Sat* node, bool removed)
+// Desc - logs every live satellite of the subtree in id order as a remove or as an insert
+void SatNet::logLive(const Sat* node, bool removed) {
+    if (node == nullptr) {
+        return;
+    }
+    logLive(node->m_left, removed);
+    if (!node->m_deleted && removed) {
+        logChange(m_changes, T_REMOVE, node->getID());
+    }
+    else if (!node->m_deleted) {
+        logChange(m_changes, T_INSERT, node->getID(), node->getAlt(), node->getInclin(), node->getState());
+    }
+    logLive(node->m_right, removed);
+}
+
+// Name - indexLive(const Sat* node)
+// Desc - adds the live satellites of the subtree to the indexes
+void SatNet::indexLive(const Sat* node) {
+    if (node == nullptr) {
+        return;
+    }
+    indexLive(node->m_left);
+    if (!node->m_deleted) {
+        indexNode(node);
+    }
+    indexLive(node->m_right);
+}
+
+// Name - indexNode(const Sat* node)
+// Desc - adds a satellite that became live to the id and shell indexes
+void SatNet::indexNode(const Sat* node) {
+    m_index.insert(node->getID());
+    m_shells.insert(shellOf(node->getAlt(), node->getInclin()), node->getID());
+}
+
+// Name - unindexNode(const Sat* node)
+// Desc - takes a satellite that is being removed or marked as a tombstone out of the indexes and
+// drops its deadline
+void SatNet::unindexNode(const Sat* node) {
+    m_index.remove(node->getID());
+    m_shells.remove(shellOf(node->getAlt(), node->getInclin()), node->getID());
+    if (!m_deadlines.empty()) {
+        m_deadlines.cancel(node->getID());
+    }
+}
+
+// Name - countShell(ALT alt, INCLIN inclin)
+// Desc - the number of satellites with altitude alt and inclination inclin
+int SatNet::countShell(ALT alt, INCLIN inclin) const {
+    return m_shells.count(shellOf(alt, inclin));
+}
+
+// Name - listShell(ALT alt, INCLIN inclin, vector<SatID>& ids)
+// Desc - appends the ids of the satellites with altitude alt and inclination inclin in ascending order
+void SatNet::listShell(ALT alt, INCLIN inclin, vector<SatID>& ids) const {
+    m_shells.list(shellOf(alt, inclin), m_minID, m_maxID, ids);
+}
+
+// Name - listShell(ALT alt, INCLIN inclin, SatID low, SatID high, vector<SatID>& ids)
+// Desc - appends the ids of the shell that are in [low, high] in ascending order
+void SatNet::listShell(ALT alt, INCLIN inclin, SatID low, SatID high, vector<SatID>& ids) const {
+    m_shells.list(shellOf(alt, inclin), low, high, ids);
+}
+
+// Name - nextSatellite(SatID id, SatID& next)
+// Desc - sets next to the smallest live id greater than id and returns true, false if there is none
+bool SatNet::nextSatellite(SatID id, SatID& next) const {
+    if (id >= m_maxID) {
+        return false;
+    }
+    if (m_index.isEnabled()) {
+        return m_index.next(id + 1, next);
+    }
+    return nextSatellite(m_root, id, next);
+}
+
+// Name - nextSatellite(const Sat* node, SatID id, SatID& next)
+// Desc - overloaded function to allow recursion, the left subtree is tried first when the node is
+// greater than id since it holds the smaller candidates. Tombstones are skipped.
+bool SatNet::nextSatellite(const Sat* node, SatID id, SatID& next) const {
+    if (node == nullptr) {
+        return false;
+    }
+    if (node->getID() <= id) {
+        return nextSatellite(node->m_right, id, next);
+    }
+    if (nextSatellite(node->m_left, id, next)) {
+        return true;
+    }
+    if (!node->m_deleted) {
+        next = node->getID();
+        return true;
+    }
+    return nextSatellite(node->m_right, id, next);
+}
+
+// Name - prevSatellite(SatID id, SatID& prev)
+// Desc - sets prev to the largest live id smaller than id and returns true, false if there is none
+bool SatNet::prevSatellite(SatID id, SatID& prev) const {
+    if (id <= m_minID) {
+        return false;
+    }
+    if (m_index.isEnabled()) {
+        return m_index.prev(id - 1, prev);
+    }
+    return prevSatellite(m_root, id, prev);
+}
+
+// Name - prevSatellite(const Sat* node, SatID id, SatID& prev)
+// Desc - overloaded function to allow recursion, the mirror image of nextSatellite
+bool SatNet::prevSatellite(const Sat* node, SatID id, SatID& prev) const {
+    if (node == nullptr) {
+        return false;
+    }
+    if (node->getID() >= id) {
+        return prevSatellite(node->m_left, id, prev);
+    }
+    if (prevSatellite(node->m_right, id, prev)) {
+        return true;
+    }
+    if (!node->m_deleted) {
+        prev = node->getID();
+        return true;
+    }
+    return prevSatellite(node->m_left, id, prev);
+}
+
+// Name - getIDs(SatID low, SatID high, vector<SatID>& ids)
+// Desc - appends the live ids in [low, high] in ascending order, through the index one next call per
+// id, otherwise with an in order walk that skips the subtrees outside the range
+void SatNet::getIDs(SatID low, SatID high, vector<SatID>& ids) const {
+    if (low > high) {
+        return;
+    }
+    if (!m_index.isEnabled()) {
+        getIDs(m_root, low, high, ids);
+        return;
+    }
+    SatID id = 0;
+    SatID from = low;
+    while (m_index.next(from, id) && id <= high) {
+        ids.push_back(id);
+        if (id == high) {
+            break;
+        }
+        from = id + 1;
+    }
+}
+
+// Name - getIDs(const Sat* node, SatID low, SatID high, vector<SatID>& ids)
+// Desc - overloaded function to allow recursion
+void SatNet::getIDs(const Sat* node, SatID low, SatID high, vector<SatID>& ids) const {
+    if (node == nullptr) {
+        return;
+    }
+    if (node->getID() > low) {
+        getIDs(node->m_left, low, high, ids);
+    }
+    if (node->getID() >= low && node->getID() <= high && !node->m_deleted) {
+        ids.push_back(node->getID());
+    }
+    if (node->getID() < high) {
+        getIDs(node->m_right, low, high, ids);
+    }
+}
+
+// Name - findNode(SatID id, SATOP op)
+// Desc - the node with id, tombstones included, or nullptr. The node is put in the lookup cache and
+// the descent is counted for op.
+Sat* SatNet::findNode(SatID id, SATOP op) const {
+    SATNET_COUNT(descents[op], 1);
+    Sat* node = m_root;
+    while (node != nullptr && node->getID() != id) {
+        SATNET_COUNT(descentDepth[op], 1);
+        SATNET_COUNT(comparisons, 2);
+        node = (id < node->getID()) ? node->m_left : node->m_right;
+    }
+    if (node != nullptr) {
+        SATNET_COUNT(descentDepth[op], 1);
+        SATNET_COUNT(comparisons, 1);
+        m_cache.fill(node);
+    }
+    return node;
+}
+
+// Name - setLookupCache(int entries)
+// Desc - resizes the lookup cache to entries slots, rounded up to a power of two, and empties it
+void SatNet::setLookupCache(int entries) {
+    m_cache.resize(entries);
+}
+
+// Name - getCacheHitRate()
+// Desc - the share of findSatellite and setState calls answered by the lookup cache
+double SatNet::getCacheHitRate() const {
+    long long probes = m_cache.getHits() + m_cache.getMisses();
+    return probes > 0 ? double(m_cache.getHits()) / probes : 0;
+}
+
+// Name - LookupCache()
+// Desc - a cache without slots, which is off
+LookupCache::LookupCache() : m_slots(nullptr), m_mask(0), m_shift(64), m_hits(0), m_misses(0) {}
+
+// Name - LookupCache(const LookupCache& rhs)
+// Desc - a copy has the same number of slots, the nodes belong to the other network so none are copied
+LookupCache::LookupCache(const LookupCache& rhs) : LookupCache() {
+    resize(rhs.getEntries());
+}
+
+// Name - operator=(const LookupCache& rhs)
+// Desc - takes rhs's number of slots, empty
+LookupCache& LookupCache::operator=(const LookupCache& rhs) {
+    if (this != &rhs) {
+        resize(rhs.getEntries());
+    }
+    return *this;
+}
+
+// Name - ~LookupCache()
+// Desc - frees the slots
+LookupCache::~LookupCache() {
+    delete[] m_slots;
+}
+
+// Name - resize(int entries)
+// Desc - replaces the slots with entries empty ones, rounded up to a power of two and capped at MAX_LOOKUP_CACHE
+void LookupCache::resize(int entries) {
+    delete[] m_slots;
+    m_slots = nullptr;
+    m_mask = 0;
+    m_shift = 64;
+    if (entries <= 0) {
+        return;
+    }
+    uint64_t size = 1;
+    while (size < uint64_t(entries) && size < uint64_t(MAX_LOOKUP_CACHE)) {
+        size *= 2;
+        m_shift--;
+    }
+    m_slots = new atomic<Sat*>[size];
+    m_mask = size - 1;
+    clear();
+}
+
+// Name - slot(SatID id)
+// Desc - Fibonacci hashing, the top bits of id times 2^64 / phi, so neighbouring ids spread over the slots
+size_t LookupCache::slot(SatID id) const {
+    return m_shift == 64 ? 0 : size_t((uint64_t(id) * 0x9E3779B97F4A7C15ULL) >> m_shift);
+}
+
+// Name - probe(SatID id)
+// Desc - the cached node for id, nullptr on a miss
+Sat* LookupCache::probe(SatID id) const {
+    Sat* node = m_slots[slot(id)].load(memory_order_relaxed);
+    if (node != nullptr && node->getID() == id) {
+        m_hits.fetch_add(1, memory_order_relaxed);
+        return node;
+    }
+    m_misses.fetch_add(1, memory_order_relaxed);
+    return nullptr;
+}
+
+// Name - fill(Sat* node)
+// Desc - puts node in its slot, replacing what was there
+void LookupCache::fill(Sat* node) const {
+    m_slots[slot(node->getID())].store(node, memory_order_relaxed);
+}
+
+// Name - forget(const Sat* node)
+// Desc - empties node's slot if it still holds node
+void LookupCache::forget(const Sat* node) {
+    atomic<Sat*>& entry = m_slots[slot(node->getID())];
+    if (entry.load(memory_order_relaxed) == node) {
+        entry.store(nullptr, memory_order_relaxed);
+    }
+}
+
+// Name - clear()
+// Desc - empties every slot
+void LookupCache::clear() {
+    for (uint64_t i = 0; m_slots != nullptr && i <= m_mask; i++) {
+        m_slots[i].store(nullptr, memory_order_relaxed);
+    }
+}
+
+// Name - resetCounts()
+// Desc - sets the hit and miss counts back to 0
+void LookupCache::resetCounts() {
+    m_hits.store(0, memory_order_relaxed);
+    m_misses.store(0, memory_order_relaxed);
+}
+
+// the slabs that haven't been freed, a plain atomic so the reclaimer thread can still free slab
+// nodes while the process exits
+static atomic<int> liveSlabs(0);
+static_assert(sizeof(NodeSlab) % alignof(Sat) == 0, "the slots must be aligned right after the slab");
+
+// Name - NodeSlab(int capacity)
+// Desc - the slots are the memory right after the slab, the slab holds one reference until it is sealed
+NodeSlab::NodeSlab(int capacity) : m_refs(1) {
+    m_capacity = capacity;
+    m_used = 0;
+    m_nodes = reinterpret_cast<Sat*>(this + 1);
+}
+
+// Name - create(int capacity)
+// Desc - allocates a slab together with its slots, without constructing them
+NodeSlab* NodeSlab::create(int capacity) {
+    capacity = max(capacity, 1);
+    void* memory = ::operator new(sizeof(NodeSlab) + sizeof(Sat) * capacity);
+    liveSlabs.fetch_add(1, memory_order_relaxed);
+    return new (memory) NodeSlab(capacity);
+}
+
+// Name - release()
+// Desc - frees the slab and its slots in one go
+void NodeSlab::release() {
+    liveSlabs.fetch_sub(1, memory_order_relaxed);
+    this->~NodeSlab();
+    ::operator delete(this);
+}
+
+// Name - place(const Sat& node)
+// Desc - copies node into the next slot, the copy keeps node's links
+Sat* NodeSlab::place(const Sat& node) {
+    if (m_used == m_capacity) {
+        return nullptr;
+    }
+    Sat* slot = new (m_nodes + m_used) Sat(node);
+    slot->m_slot = m_used;
+    m_used++;
+    m_refs.fetch_add(1, memory_order_relaxed);
+    return slot;
+}
+
+// Name - seal()
+// Desc - drops the slab's own reference, freeing it if none of its nodes are left
+void NodeSlab::seal() {
+    if (m_refs.fetch_sub(1, memory_order_acq_rel) == 1) {
+        release();
+    }
+}
+
+// Name - free(Sat* node)
+// Desc - deletes a heap node, a slab node drops its slab's reference and the last one frees the slab
+void NodeSlab::free(Sat* node) {
+    if (node->m_slot < 0) {
+        delete node;
+        return;
+    }
+    // slot 0 sits right after the slab
+    NodeSlab* slab = reinterpret_cast<NodeSlab*>(node - node->m_slot) - 1;
+    if (slab->m_refs.fetch_sub(1, memory_order_acq_rel) == 1) {
+        slab->release();
+    }
+}
+
+// Name - getSlabs()
+// Desc - the number of slabs that haven't been freed
+int NodeSlab::getSlabs() {
+    return liveSlabs.load(memory_order_relaxed);
+}
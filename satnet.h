@@ -1,133 +1,533 @@
-#ifndef SATNET_H
-#define SATNET_H
-#include <iostream>
-using namespace std;
-class Tester;
-class SatNet;
-const int MINID = 10000;
-const int MAXID = 99999;
-enum STATE {ACTIVE, DEORBITED, DECAYING};
-enum ALT {MI208, MI215, MI340, MI350};  // altitude in miles
-enum INCLIN {I48, I53, I70, I97};       // inclination in degrees
-#define DEFAULT_HEIGHT 0
-#define DEFAULT_ID 0
-#define DEFAULT_INCLIN I48
-#define DEFAULT_ALT MI208
-#define DEFAULT_STATE ACTIVE
-class Sat{
-    public:
-    friend class SatNet;
-    friend class Tester;
-    Sat(int id, ALT alt=DEFAULT_ALT, INCLIN inclin = DEFAULT_INCLIN, STATE state = DEFAULT_STATE)
-        :m_id(id),m_altitude(alt), m_inclin(inclin), m_state(state) {
-            m_left = nullptr;
-            m_right = nullptr;
-            m_height = DEFAULT_HEIGHT;
-        }
-    Sat(){
-        m_id = DEFAULT_ID;
-        m_altitude = DEFAULT_ALT;
-        m_inclin = DEFAULT_INCLIN;
-        m_state = DEFAULT_STATE;
-        m_left = nullptr;
-        m_right = nullptr;
-        m_height = DEFAULT_HEIGHT;
-    }
-    int getID() const {return m_id;}
-    STATE getState() const {return m_state;}
-    string getStateStr() const {
-        string text = "";
-        switch (m_state){
-            case ACTIVE:text = "Active";break;
-            case DEORBITED:text = "Deorbited";break;
-            case DECAYING:text = "Decaying";break;
-            default:text = "UNKNOWN";break;
-        }
-        return text;
-    }
-    INCLIN getInclin() const {return m_inclin;}
-    string getInclinStr() const {
-        string text = "";
-        switch (m_inclin){
-            case I48:text = "48 degrees";break;
-            case I53:text = "53 degrees";break;
-            case I70:text = "70 degrees";break;
-            case I97:text = "97 degrees";break;
-            default:text = "UNKNOWN";break;
-        }
-        return text;
-    }
-    ALT getAlt() const {return m_altitude;}
-    string getAltStr() const {
-        string text = "";
-        switch (m_altitude){
-            case MI208:text = "208 miles";break;
-            case MI215:text = "215 miles";break;
-            case MI340:text = "340 miles";break;
-            case MI350:text = "350 miles";break;
-            default:text = "UNKNOWN";break;
-        }
-        return text;
-    }
-    int getHeight() const {return m_height;}
-    Sat* getLeft() const {return m_left;}
-    Sat* getRight() const {return m_right;}
-    void setID(const int id){m_id=id;}
-    void setState(STATE state){m_state=state;}
-    void setInclin(INCLIN degree){m_inclin=degree;}
-    void setAlt(ALT altitude){m_altitude=altitude;}
-    void setHeight(int height){m_height=height;}
-    void setLeft(Sat* left){m_left=left;}
-    void setRight(Sat* right){m_right=right;}
-    private:
-    int m_id;
-    ALT m_altitude;
-    INCLIN m_inclin;
-    STATE m_state;
-    Sat* m_left;    //the pointer to the left child in the BST
-    Sat* m_right;   //the pointer to the right child in the BST
-    int m_height;   //the height of node in the BST
-};
-class SatNet{
-    public:
-    friend class Tester;
-    SatNet();
-    ~SatNet();
-    // overloaded assignment operator
-    const SatNet & operator=(const SatNet & rhs);
-    void insert(const Sat& satellite);
-    void clear();
-    void remove(int id);
-    void dumpTree() const;
-    void listSatellites() const;
-    bool setState(int id, STATE state);
-    void removeDeorbited();//removes all deorbited satellites from the tree
-    bool findSatellite(int id) const;//returns true if the satellite is in tree
-    int countSatellites(INCLIN degree) const;
-    
-    private:
-    Sat* m_root;    //the root of the BST
-    //helper for recursive traversal
-    void dump(Sat* satellite) const;
-
-    // ***************************************************
-    // Any private helper functions must be delared here!
-    // ***************************************************
-    // overloaded functions
-    void insert(const Sat& satellite, Sat*& node);
-    void clear(Sat*& node);
-    void remove(int id, Sat*& node);
-    void listSatellites(Sat* node) const; 
-    bool setState(int id, STATE state, Sat*& node);
-    void removeDeorbited(Sat*& node);
-    int countSatellites(Sat* node, INCLIN degree) const;
-    bool findSatellite(const Sat* node, int id) const;
-    Sat* copy(const Sat* node) const;
-    // helpers
-    void leftRotate(Sat*& node);
-    void rightRotate(Sat*& node);
-    void updateHeight(Sat*& node);
-    int getBalance(Sat* node);
-    void rebalance(Sat*& node);
-};
-#endif
+#ifndef SATNET_H
+#define SATNET_H
+#include <iostream>
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "latency.h"
+#include "idindex.h"
+#include "shellindex.h"
+#include "timerwheel.h"
+#include "avlcatalog.h"
+using namespace std;
+class Tester;
+class SatNet;
+class TraceWriter;
+class TaskPool;
+class ChangeLog;
+class NodeSlab;
+// the key type used to order the satellites in the tree, 64 bits wide so large sparse catalogs fit
+typedef int64_t SatID;
+// the default id range, a SatNet can be constructed with any other range
+constexpr SatID MINID = 10000;
+constexpr SatID MAXID = 99999;
+static_assert(MINID <= MAXID, "MINID must not be greater than MAXID");
+// the operation counters are only compiled in when SATNET_STATS is defined, e.g. g++ -DSATNET_STATS
+#ifdef SATNET_STATS
+#define SATNET_COUNT(counter, amount) m_counters.counter.fetch_add(amount, memory_order_relaxed)
+#else
+#define SATNET_COUNT(counter, amount)
+#endif
+enum STATE {ACTIVE, DEORBITED, DECAYING};
+enum ALT {MI208, MI215, MI340, MI350};  // altitude in miles
+enum INCLIN {I48, I53, I70, I97};       // inclination in degrees
+enum LAYOUT {LAYOUT_VEB, LAYOUT_BFS};   // the node orders of SatNet::compact
+#define DEFAULT_HEIGHT 0
+#define DEFAULT_ID 0
+#define DEFAULT_INCLIN I48
+#define DEFAULT_ALT MI208
+#define DEFAULT_STATE ACTIVE
+#define DEFAULT_COMPACT_FRACTION 0.25
+#define PARALLEL_CUTOFF 10  // parallel set operations go sequential below subtrees of this height
+#define DEFAULT_LOOKUP_CACHE 1024   // slots of the lookup cache, see SatNet::setLookupCache
+#define MAX_LOOKUP_CACHE (1 << 20)
+// a snapshot of the operation counters and the shape of the tree returned by SatNet::stats()
+// the counters stay 0 unless SATNET_STATS is defined
+struct SatStats{
+    long long comparisons = 0;      // id comparisons made while descending the tree
+    long long leftRotations = 0;    // calls to leftRotate
+    long long rightRotations = 0;   // calls to rightRotate
+    long long doubleRotations = 0;  // left-right and right-left cases, each also counts its two single rotations
+    long long allocations = 0;      // nodes allocated
+    long long frees = 0;            // nodes deallocated or handed to the background reclaimer
+    // indexed by SATOP, only insert, remove, setState and findSatellite(s) descend the tree
+    long long descents[NUM_SATOPS] = {};        // calls that descended, one per id for findSatellites
+    long long descentDepth[NUM_SATOPS] = {};    // nodes visited by those calls
+    int nodeCount = 0;
+    int height = -1;                // height of the root, -1 for an empty tree
+    double averageDepth = 0;        // average distance of a node from the root
+    int tombstones = 0;             // nodes removed lazily but still in the tree, part of nodeCount
+    long long bytesUsed = 0;        // the SatNet object plus its nodes and latency histograms
+};
+// the data of a satellite, a node of the tree is a Sat: this payload with the id and the tree fields
+// of CatalogNode added, see avlcatalog.h
+class SatPayload{
+    public:
+    friend class SatNet;
+    friend class Tester;
+    friend class NodeSlab;
+    SatPayload(ALT alt=DEFAULT_ALT, INCLIN inclin = DEFAULT_INCLIN, STATE state = DEFAULT_STATE)
+        :m_altitude(alt), m_inclin(inclin), m_state(state) {
+            m_slot = -1;
+        }
+    STATE getState() const {return m_state;}
+    string getStateStr() const {
+        string text = "";
+        switch (m_state){
+            case ACTIVE:text = "Active";break;
+            case DEORBITED:text = "Deorbited";break;
+            case DECAYING:text = "Decaying";break;
+            default:text = "UNKNOWN";break;
+        }
+        return text;
+    }
+    INCLIN getInclin() const {return m_inclin;}
+    string getInclinStr() const {
+        string text = "";
+        switch (m_inclin){
+            case I48:text = "48 degrees";break;
+            case I53:text = "53 degrees";break;
+            case I70:text = "70 degrees";break;
+            case I97:text = "97 degrees";break;
+            default:text = "UNKNOWN";break;
+        }
+        return text;
+    }
+    ALT getAlt() const {return m_altitude;}
+    string getAltStr() const {
+        string text = "";
+        switch (m_altitude){
+            case MI208:text = "208 miles";break;
+            case MI215:text = "215 miles";break;
+            case MI340:text = "340 miles";break;
+            case MI350:text = "350 miles";break;
+            default:text = "UNKNOWN";break;
+        }
+        return text;
+    }
+    void setState(STATE state){m_state=state;}
+    void setInclin(INCLIN degree){m_inclin=degree;}
+    void setAlt(ALT altitude){m_altitude=altitude;}
+    private:
+    ALT m_altitude;
+    INCLIN m_inclin;
+    STATE m_state;
+    int m_slot;     //the node's slot in its NodeSlab, -1 for a node with its own heap allocation
+};
+// Sat(id, alt, inclin, state) builds a satellite, Sat() has id DEFAULT_ID and the default data
+typedef CatalogNode<SatID, SatPayload> Sat;
+static_assert(sizeof(Sat) == 56, "the SatPayload fields should fill the padding before the id");
+// A handle to a satellite in a SatNet. Nodes are only moved by compact, so a handle stays valid and
+// keeps pointing at the same satellite until it is removed from its network (remove, removeDeorbited,
+// clear, difference, the destructor, or a tombstone being purged), moved to another network (join,
+// split, extractRange) or its network is compacted. compact frees every node it moves, so a handle
+// taken before it dangles and using it is undefined. Copies made by operator= get new nodes.
+typedef const Sat* SatHandle;
+// A direct mapped cache from recently looked up ids to their nodes. A slot only holds the node, a
+// probe is a hit when the node's id matches, so every slot is a single atomic that concurrent readers
+// (see asyncnet.h) can fill without a lock. The network must forget a node before freeing it.
+class LookupCache{
+    public:
+    LookupCache();
+    LookupCache(const LookupCache& rhs);// the same number of slots, all empty
+    LookupCache& operator=(const LookupCache& rhs);
+    ~LookupCache();
+    void resize(int entries);// rounds entries up to a power of two, 0 turns the cache off
+    bool isEnabled() const {return m_slots != nullptr;}
+    int getEntries() const {return m_slots == nullptr ? 0 : int(m_mask + 1);}
+    Sat* probe(SatID id) const;// the cached node with id or nullptr, counts a hit or a miss
+    void fill(Sat* node) const;
+    void forget(const Sat* node);// empties node's slot if it holds node
+    void clear();
+    long long getHits() const {return m_hits.load(memory_order_relaxed);}
+    long long getMisses() const {return m_misses.load(memory_order_relaxed);}
+    void resetCounts();
+    private:
+    size_t slot(SatID id) const;
+    atomic<Sat*>* m_slots;
+    uint64_t m_mask;
+    int m_shift;
+    mutable atomic<long long> m_hits;
+    mutable atomic<long long> m_misses;
+};
+// A contiguous block of nodes filled by SatNet::compact. A slab is shared by every network its nodes
+// end up in through join, split and extractRange, and it is freed with the last of its nodes, so tree
+// nodes are always freed with NodeSlab::free and never with delete. Slots aren't reused, the next
+// compact moves the remaining nodes out of an old slab. The slots follow the slab in one allocation,
+// so free finds a node's slab from its slot number without a lookup or a lock.
+class NodeSlab{
+    public:
+    static NodeSlab* create(int capacity);// an empty slab with room for capacity nodes
+    Sat* place(const Sat& node);// copies node with its links into the next slot, nullptr when full
+    void seal();// no more nodes will be placed, the slab is freed with its last node
+    static void free(Sat* node);// frees a node of a slab or of the heap
+    static int getSlabs();// the slabs alive in the process
+    private:
+    NodeSlab(int capacity);
+    void release();// destroys the slab and its slots, every node in them has been freed
+    Sat* m_nodes;
+    int m_capacity;
+    int m_used;             //slots filled by place
+    atomic<int> m_refs;     //the live nodes, plus one until the slab is sealed
+};
+// the hooks SatNet's AvlCatalog calls on every rotation, the counts are read by SatNet::stats()
+struct SatHooks{
+#ifdef SATNET_STATS
+    atomic<long long> leftRotations{0};
+    atomic<long long> rightRotations{0};
+    atomic<long long> doubleRotations{0};
+    void rotated(CatalogRotation rotation) {
+        atomic<long long>& counter = rotation == ROTATE_LEFT ? leftRotations :
+                                     rotation == ROTATE_RIGHT ? rightRotations : doubleRotations;
+        counter.fetch_add(1, memory_order_relaxed);
+    }
+#else
+    void rotated(CatalogRotation) {}
+#endif
+};
+// the tree engine of SatNet, over the whole SatID range so the engine's own range check compiles away
+typedef AvlCatalog<SatID, SatPayload, numeric_limits<SatID>::min(), numeric_limits<SatID>::max(), SatHooks> SatCatalog;
+// A SatCatalog with the id range of the network checked at run time, the indexes, the lazy removes,
+// the set operations and the recording of its calls and changes. The catalog is a protected base since
+// its insert, remove and clear would bypass the indexes, only its read-only lookups are public.
+class SatNet : protected SatCatalog{
+    public:
+    friend class Tester;
+    friend class ForkSnapshot;
+    SatNet();
+    SatNet(SatID minID, SatID maxID);// uses the id range minID - maxID instead of MINID - MAXID
+    ~SatNet();
+    // overloaded assignment operator
+    const SatNet & operator=(const SatNet & rhs);
+    // returns a handle to the new satellite, nullptr if the id is invalid or already in the tree
+    SatHandle insert(const Sat& satellite);
+    void clear();
+    // when on, clear, operator= and the destructor detach the tree in O(1) and leave the freeing to the
+    // background Reclaimer, see reclaimer.h. Off by default.
+    void setBackgroundClear(bool background) {m_backgroundClear = background;}
+    void remove(SatID id);
+    void dumpTree() const;
+    void listSatellites() const;
+    bool setState(SatID id, STATE state);
+    // O(1) setState through a handle returned by insert, false if the satellite was removed lazily
+    bool setState(SatHandle handle, STATE state);
+    void removeDeorbited();//removes all deorbited satellites from the tree
+    // setState that also gives a DECAYING satellite a deadline, in ticks of the caller's clock, after
+    // which expireDecaying moves it to DEORBITED. The deadline is dropped when the satellite's state is
+    // set again, when it is removed and when it moves to another network (join, split, extractRange).
+    bool setState(SatID id, STATE state, long long deadline);
+    // Moves every DECAYING satellite whose deadline is at or before now to DEORBITED through the timer
+    // wheel of timerwheel.h, O(1) per expiry plus the descent that updates the node, then runs
+    // removeDeorbited if purge is true. The changes are traced and logged as setState calls. Returns
+    // the number of satellites moved.
+    int expireDecaying(long long now, bool purge = false);
+    int getDeadlines() const {return m_deadlines.size();}// the satellites waiting for a deadline
+    bool getDeadline(SatID id, long long& deadline) const {return m_deadlines.getDeadline(id, deadline);}
+    // Bulk changes in one traversal: predicate(const Sat&) is called once on every satellite and is
+    // inlined. updateWhere sets the state of the matches, removeWhere removes them and rebuilds the tree
+    // in O(n) when that is cheaper than removing them one at a time. Both return the number of matches
+    // and are traced and logged as the setState and remove calls they replace. The versions with a pool
+    // split the traversal over its threads, predicate must then be safe to call concurrently.
+    template <class Predicate> int updateWhere(Predicate predicate, STATE state);
+    template <class Predicate> int updateWhere(Predicate predicate, STATE state, TaskPool& pool);
+    template <class Predicate> int removeWhere(Predicate predicate);
+    template <class Predicate> int removeWhere(Predicate predicate, TaskPool& pool);
+    bool findSatellite(SatID id) const;//returns true if the satellite is in tree
+    // the catalog's lookup and in-order walk, without the lookup cache and the counters. find returns a
+    // handle to the satellite with id, forEach calls visit(const Sat&) on every satellite.
+    using SatCatalog::find;
+    template <class Visit> void forEach(Visit visit) const {SatCatalog::forEach(visit);}
+    // looks up many ids in one traversal, ids must be in ascending order and found[i] is set for ids[i]
+    void findSatellites(const vector<SatID>& ids, vector<bool>& found) const;
+    int countSatellites(INCLIN degree) const;
+    // order statistics over the live satellites, kept up to date through the subtree sizes
+    int size() const {return m_nodes - m_tombstones;}// the number of satellites, O(1)
+    int rank(SatID id) const;// the number of satellites with an id smaller than id, O(log n)
+    SatHandle select(int k) const;// the satellite with the k-th smallest id counting from 0, nullptr if there is none
+    SatHandle percentile(double p) const;// the nearest rank p-th percentile by id, p in [0, 100]
+    // ordered queries over the live ids, answered by the bitmap index of idindex.h for id ranges up to
+    // MAX_INDEX_UNIVERSE ids and by walking the tree for wider ones
+    bool nextSatellite(SatID id, SatID& next) const;// the smallest id greater than id, false if there is none
+    bool prevSatellite(SatID id, SatID& prev) const;// the largest id smaller than id, false if there is none
+    void getIDs(SatID low, SatID high, vector<SatID>& ids) const;// appends the ids in [low, high] in ascending order
+    // every orbital shell, one of the 16 altitude and inclination pairs, keeps an ordered index of its ids
+    static int shellOf(ALT alt, INCLIN inclin) {return alt * 4 + inclin;}
+    int countShell(ALT alt, INCLIN inclin) const;// the number of satellites in the shell, O(1)
+    void listShell(ALT alt, INCLIN inclin, vector<SatID>& ids) const;// appends the shell's ids in ascending order, O(k)
+    void listShell(ALT alt, INCLIN inclin, SatID low, SatID high, vector<SatID>& ids) const;// only the ids in [low, high]
+    // caches the nodes of recently looked up ids in entries slots so findSatellite and setState on hot ids
+    // take one probe instead of a descent, 0 turns the cache off. Off by default.
+    void setLookupCache(int entries = DEFAULT_LOOKUP_CACHE);
+    long long getCacheHits() const {return m_cache.getHits();}
+    long long getCacheMisses() const {return m_cache.getMisses();}
+    double getCacheHitRate() const;// hits over probes since the last resetStats(), 0 before the first probe
+    // when lazy is true remove only marks the node as a tombstone, the tree is rebuilt without the
+    // tombstones once they are more than compactFraction of the nodes. Turning it off purges them.
+    void setLazyRemove(bool lazy, double compactFraction = DEFAULT_COMPACT_FRACTION);
+    // Moves every node into one NodeSlab in van Emde Boas or breadth first order of the tree, so a
+    // descent touches a few neighbouring cache lines and pages however the heap was churned. The tree
+    // keeps its shape and stays fully mutable, new nodes still come from the heap. The old nodes are
+    // freed, so every SatHandle into the network (from insert, select or percentile) dangles afterwards
+    // and must not be used, not even for setState. Look the satellites up again instead.
+    void compact(LAYOUT layout = LAYOUT_VEB);
+    // the same relayout in bounded steps: beginCompact records the order of the ids, each compactStep
+    // moves up to maxNodes of them with one descent each and returns true once all of them are moved.
+    // Satellites inserted after beginCompact stay where they are. Each step leaves the handles of the
+    // satellites it moved dangling like compact does.
+    void beginCompact(LAYOUT layout = LAYOUT_VEB);
+    bool compactStep(int maxNodes);
+    bool isCompacting() const {return m_compactSlab != nullptr;}
+    void purgeTombstones();// rebuilds the tree without the tombstones in O(n)
+    int getTombstones() const {return m_tombstones;}
+    // bulk set operations built on AVL join and split
+    void join(SatNet& rhs);// moves every satellite of rhs into this network, O(log n) when rhs's ids are all larger
+    void split(SatID id, SatNet& right);// moves the satellites with ids >= id into right
+    void unionWith(const SatNet& rhs);// copies in every satellite of rhs, rhs's data wins on equal ids
+    void difference(const SatNet& rhs);// removes every id that is in rhs
+    // the same operations with the recursion spread over the threads of pool
+    void unionWith(const SatNet& rhs, TaskPool& pool);
+    void difference(const SatNet& rhs, TaskPool& pool);
+    void extractRange(SatID low, SatID high, SatNet& dest);// moves the ids in [low, high] into dest
+    SatStats stats() const;// snapshot of the counters and the tree shape
+    void resetStats();// sets the counters back to 0
+    // times 1 of every sampleRate calls of each public operation, 0 turns the timing off. The
+    // histograms are only allocated the first time the timing is turned on.
+    void setLatencySampling(int sampleRate);
+    const LatencyRecorder& latency() const;
+    // every public insert, remove, setState, findSatellite and removeDeorbited call is written to
+    // writer until recordTrace(nullptr) is called, see trace.h
+    void recordTrace(TraceWriter* writer) {m_trace = writer;}
+    TraceWriter* getTrace() const {return m_trace;}// the trace being recorded, nullptr if none
+    // every change the network makes is appended to log until recordChanges(nullptr) is called or the
+    // network is destroyed, which logs nothing, see cdc.h
+    void recordChanges(ChangeLog* log) {m_changes = log;}
+    // appends a copy of every satellite in ascending order of ids
+    void getSatellites(vector<Sat>& satellites) const;
+    SatID getMinID() const {return m_minID;}
+    SatID getMaxID() const {return m_maxID;}
+    
+    private:
+    SatID m_minID;  //the smallest id allowed in the tree
+    SatID m_maxID;  //the largest id allowed in the tree
+#ifdef SATNET_STATS
+    // relaxed atomics so the counters are cheap to leave on and safe to read from another thread
+    struct Counters{
+        atomic<long long> comparisons{0};
+        atomic<long long> allocations{0};
+        atomic<long long> frees{0};
+        atomic<long long> descents[NUM_SATOPS] = {};
+        atomic<long long> descentDepth[NUM_SATOPS] = {};
+    };
+    mutable Counters m_counters;
+#endif
+    unique_ptr<LatencyRecorder> m_latency;  //per operation latency histograms, nullptr until the timing is turned on
+    TraceWriter* m_trace;   //the trace the calls are recorded to, nullptr when not recording
+    ChangeLog* m_changes;   //the log the changes are appended to, nullptr when not recording
+    bool m_lazy;            //true if remove leaves tombstones
+    bool m_backgroundClear; //true if the tree is freed by the reclaimer thread
+    double m_compactFraction;   //the share of tombstones that triggers a rebuild
+    int m_tombstones;       //the number of tombstones in the tree
+    IdIndex m_index;        //the live ids, off for wide id ranges
+    LookupCache m_cache;    //recently looked up nodes, off by default
+    ShellIndex m_shells;    //the live ids of every orbital shell
+    TimerWheel m_deadlines; //the deadlines of DECAYING satellites, empty unless setState was given one
+    NodeSlab* m_compactSlab;        //the slab filled by compactStep, nullptr when none is running
+    vector<SatID> m_compactOrder;   //the ids compactStep moves, in layout order
+    size_t m_compactNext;           //the next id of m_compactOrder to move
+    // a satellite a bulk operation added (no before), removed (no after) or gave new data, kept by
+    // the networks of parallel tasks until the parent applies it in absorb
+    struct Change{
+        Sat before;
+        Sat after;
+        bool hasBefore;
+        bool hasAfter;
+    };
+    bool m_deferChanges;        //true for the networks of parallel tasks, see noteChange
+    int m_bulkLogged;           //changes the running bulk operation logged, see logBulk
+    vector<Change> m_deferred;  //the changes noted by a parallel task's network
+    //helper for recursive traversal
+    void dump(Sat* satellite) const;
+
+    // ***************************************************
+    // Any private helper functions must be delared here!
+    // ***************************************************
+    // overloaded functions
+    Sat* insert(const Sat& satellite, Sat*& node);
+    void clear(Sat*& node);
+    void release();
+    void endCompact();
+    void layout(LAYOUT order, vector<Sat*>& nodes) const;
+    void layoutVEB(Sat* node, int levels, vector<Sat*>& nodes) const;
+    void layoutBottoms(Sat* node, int depth, int levels, vector<Sat*>& nodes) const;
+    Sat** findLink(SatID id);
+    void invalidateChanges();
+    void setRange(SatID minID, SatID maxID);
+    void noteChange(const Sat* before, const Sat* after);
+    void logBulk(const Sat* before, const Sat* after);
+    void logLive(const Sat* node, bool removed);
+    int moveIn(SatNet& from, const Sat* node);
+    Sat* findNode(SatID id, SATOP op) const;
+    void indexLive(const Sat* node);
+    void indexNode(const Sat* node);
+    void unindexNode(const Sat* node);
+    bool nextSatellite(const Sat* node, SatID id, SatID& next) const;
+    bool prevSatellite(const Sat* node, SatID id, SatID& prev) const;
+    void getIDs(const Sat* node, SatID low, SatID high, vector<SatID>& ids) const;
+    void getSatellites(const Sat* node, vector<Sat>& satellites) const;
+    void findSatellites(const Sat* node, const vector<SatID>& ids, int low, int high, vector<bool>& found) const;
+    void remove(SatID id, Sat*& node);
+    void listSatellites(Sat* node) const; 
+    bool setState(SatID id, STATE state, Sat*& node);
+    void removeDeorbited(Sat*& node);
+    template <class Predicate> void updateWhere(Sat* node, Predicate& predicate, STATE state, vector<SatID>& ids);
+    template <class Predicate> void updateWhere(Sat* node, Predicate& predicate, STATE state, vector<SatID>& ids, TaskPool& pool);
+    template <class Predicate> void markWhere(Sat* node, Predicate& predicate, vector<Sat*>& nodes);
+    template <class Predicate> void markWhere(Sat* node, Predicate& predicate, vector<Sat*>& nodes, TaskPool& pool);
+    void finishUpdate(const vector<SatID>& ids, STATE state);
+    void finishRemove(const vector<Sat*>& nodes);
+    static void forkJoin(TaskPool& pool, const function<void()>& first, const function<void()>& second);
+    void collectDeorbited(const Sat* node, vector<SatID>& ids) const;
+    int countSatellites(Sat* node, INCLIN degree) const;
+    bool findSatellite(const Sat* node, SatID id) const;
+    Sat* copy(const Sat* node);
+    bool markRemoved(SatID id);
+    void markDeorbited(Sat* node);
+    void collectLive(Sat* node, vector<Sat*>& nodes);
+    Sat* build(vector<Sat*>& nodes, int low, int high);
+    // join and split helpers, the trees they take and return are balanced
+    Sat* join(Sat* left, Sat* middle, Sat* right);
+    Sat* joinRight(Sat* left, Sat* middle, Sat* right);
+    Sat* joinLeft(Sat* left, Sat* middle, Sat* right);
+    Sat* join2(Sat* left, Sat* right);
+    Sat* splitMin(Sat*& node);
+    void split(Sat* node, SatID id, Sat*& left, Sat*& found, Sat*& right);
+    Sat* unionWith(Sat* node, const Sat* other);
+    Sat* difference(Sat* node, const Sat* other);
+    Sat* unionWith(Sat* node, const Sat* other, TaskPool& pool);
+    Sat* difference(Sat* node, const Sat* other, TaskPool& pool);
+    Sat* unionRoot(Sat* left, Sat* found, Sat* right, const Sat* other);
+    Sat* differenceRoot(Sat* left, Sat* found, Sat* right, const Sat* other);
+    void absorb(const SatNet& part);
+    using SatCatalog::size;// size(node), the subtree size, next to size()
+    void adopt(SatNet& from, Sat* root, int nodes);
+    void shape(const Sat* node, int depth, SatStats& result) const;
+    // every node is allocated and freed through these two so they can be counted
+    Sat* allocNode(SatID id, ALT alt, INCLIN inclin, STATE state);
+    void freeNode(Sat* node);
+};
+
+// the predicate templates are defined here so every caller's predicate is inlined into the traversal
+
+// Name - updateWhere(Predicate predicate, STATE state)
+// Desc - sets the state of every satellite that matches predicate, returns how many matched
+template <class Predicate>
+int SatNet::updateWhere(Predicate predicate, STATE state) {
+    vector<SatID> ids;
+    updateWhere(m_root, predicate, state, ids);
+    finishUpdate(ids, state);
+    return ids.size();
+}
+
+// Name - updateWhere(Predicate predicate, STATE state, TaskPool& pool)
+// Desc - the same result as updateWhere(predicate, state) computed with the threads of pool
+template <class Predicate>
+int SatNet::updateWhere(Predicate predicate, STATE state, TaskPool& pool) {
+    vector<SatID> ids;
+    updateWhere(m_root, predicate, state, ids, pool);
+    finishUpdate(ids, state);
+    return ids.size();
+}
+
+// Name - removeWhere(Predicate predicate)
+// Desc - removes every satellite that matches predicate, returns how many matched
+template <class Predicate>
+int SatNet::removeWhere(Predicate predicate) {
+    vector<Sat*> nodes;
+    markWhere(m_root, predicate, nodes);
+    finishRemove(nodes);
+    return nodes.size();
+}
+
+// Name - removeWhere(Predicate predicate, TaskPool& pool)
+// Desc - the same result as removeWhere(predicate) with the matches marked by the threads of pool
+template <class Predicate>
+int SatNet::removeWhere(Predicate predicate, TaskPool& pool) {
+    vector<Sat*> nodes;
+    markWhere(m_root, predicate, nodes, pool);
+    finishRemove(nodes);
+    return nodes.size();
+}
+
+// Name - updateWhere(Sat* node, Predicate& predicate, STATE state, vector<SatID>& ids)
+// Desc - overloaded function to allow recursion, adds the changed ids to ids in ascending order
+template <class Predicate>
+void SatNet::updateWhere(Sat* node, Predicate& predicate, STATE state, vector<SatID>& ids) {
+    if (node == nullptr) {
+        return;
+    }
+    updateWhere(node->m_left, predicate, state, ids);
+    if (!node->m_deleted && predicate(static_cast<const Sat&>(*node))) {
+        node->setState(state);
+        ids.push_back(node->getID());
+    }
+    updateWhere(node->m_right, predicate, state, ids);
+}
+
+// Name - updateWhere(Sat* node, Predicate& predicate, STATE state, vector<SatID>& ids, TaskPool& pool)
+// Desc - overloaded function to allow recursion, both subtrees are parallel tasks down to the subtrees
+// of height PARALLEL_CUTOFF. The right subtree collects its ids separately so they stay in order.
+template <class Predicate>
+void SatNet::updateWhere(Sat* node, Predicate& predicate, STATE state, vector<SatID>& ids, TaskPool& pool) {
+    if (node == nullptr || node->m_height <= PARALLEL_CUTOFF) {
+        updateWhere(node, predicate, state, ids);
+        return;
+    }
+    vector<SatID> rightIDs;
+    forkJoin(pool, [&] {updateWhere(node->m_left, predicate, state, ids, pool);},
+             [&] {updateWhere(node->m_right, predicate, state, rightIDs, pool);});
+    if (!node->m_deleted && predicate(static_cast<const Sat&>(*node))) {
+        node->setState(state);
+        ids.push_back(node->getID());
+    }
+    ids.insert(ids.end(), rightIDs.begin(), rightIDs.end());
+}
+
+// Name - markWhere(Sat* node, Predicate& predicate, vector<Sat*>& nodes)
+// Desc - overloaded function to allow recursion, marks the matches as tombstones and fixes the subtree
+// sizes on the way back up. finishRemove does the counting, the unindexing and the removing.
+template <class Predicate>
+void SatNet::markWhere(Sat* node, Predicate& predicate, vector<Sat*>& nodes) {
+    if (node == nullptr) {
+        return;
+    }
+    markWhere(node->m_left, predicate, nodes);
+    if (!node->m_deleted && predicate(static_cast<const Sat&>(*node))) {
+        node->m_deleted = true;
+        nodes.push_back(node);
+    }
+    markWhere(node->m_right, predicate, nodes);
+    updateHeight(node);
+}
+
+// Name - markWhere(Sat* node, Predicate& predicate, vector<Sat*>& nodes, TaskPool& pool)
+// Desc - overloaded function to allow recursion, the parallel version with the task structure of the
+// parallel updateWhere
+template <class Predicate>
+void SatNet::markWhere(Sat* node, Predicate& predicate, vector<Sat*>& nodes, TaskPool& pool) {
+    if (node == nullptr || node->m_height <= PARALLEL_CUTOFF) {
+        markWhere(node, predicate, nodes);
+        return;
+    }
+    vector<Sat*> rightNodes;
+    forkJoin(pool, [&] {markWhere(node->m_left, predicate, nodes, pool);},
+             [&] {markWhere(node->m_right, predicate, rightNodes, pool);});
+    if (!node->m_deleted && predicate(static_cast<const Sat&>(*node))) {
+        node->m_deleted = true;
+        nodes.push_back(node);
+    }
+    nodes.insert(nodes.end(), rightNodes.begin(), rightNodes.end());
+    updateHeight(node);
+}
+#endif
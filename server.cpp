@@ -0,0 +1,436 @@
+// Title: server.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: A catalog server that serves one SatNet over a Unix or TCP socket with the binary
+// protocol of protocol.h.
+//
+// Usage:
+//   ./server unix <path> [keys]
+//   ./server tcp <port> [keys]
+// keys satellites are loaded from the workload generator first (default 50000, 0 for an empty
+// network) so loadgen has something to look up. The server runs until SIGINT or SIGTERM.
+//
+// One thread runs an epoll loop over non-blocking sockets. Every request a connection has sent is
+// handled in the round it arrives in, so pipelined requests cost no extra round trips. Finds are
+// not answered one at a time: the finds of all connections in a round are collected, sorted and
+// looked up with a single findSatellites traversal. A request that changes the network first
+// resolves the finds collected before it, so each connection still sees its requests in order.
+//
+// A client that pipelines requests without reading the replies isn't read from while it has more
+// than MAX_UNSENT bytes of replies waiting, so one connection can't make the server's memory grow
+// without bound. The requests it already sent wait in its input until EPOLLOUT drains the output.
+
+#include "satnet.h"
+#include "protocol.h"
+#include "workload.h"
+#include <algorithm>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <unordered_map>
+using namespace std;
+
+const int DEFAULT_KEYS = 50000;
+const int MAX_EVENTS = 256;
+const int READ_SIZE = 65536;
+const int STOP_CHECK_MS = 200;  // how often epoll_wait returns to check for a signal
+const size_t MAX_UNSENT = 1 << 20;  // the output a connection may have waiting before it is no longer read
+
+volatile sig_atomic_t g_stop = 0;
+
+// one client connection with its unparsed input and unsent output
+struct Connection{
+    int fd = -1;
+    vector<unsigned char> in;
+    size_t inPos = 0;
+    vector<unsigned char> out;
+    size_t outPos = 0;
+    bool closing = false;   // the client hung up or sent garbage, close once the output is sent
+    bool touched = false;   // part of the current round
+    bool held = false;      // requests were left in the input because too much output was waiting
+    size_t unsent() const {return out.size() - outPos;}
+};
+
+// a find waiting for the batched lookup, pos is its status byte in the connection's output
+struct PendingFind{
+    SatID id;
+    Connection* conn;
+    size_t pos;
+    bool operator<(const PendingFind& rhs) const {return id < rhs.id;}
+};
+
+class Server{
+    public:
+    Server(SatNet& network) : m_network(network) {}
+    int run(int listenFd);
+    void report() const;
+    private:
+    void accept(int listenFd);
+    void readFrom(Connection* conn);
+    void handle(Connection* conn);
+    void flushFinds();
+    bool writeTo(Connection* conn);
+    void closeConnection(Connection* conn);
+    SatNet& m_network;
+    int m_epoll = -1;
+    unordered_map<int, Connection*> m_connections;
+    vector<Connection*> m_round;
+    vector<PendingFind> m_finds;
+    vector<SatID> m_ids;
+    vector<bool> m_found;
+    long long m_requests = 0;
+    long long m_batches = 0;
+    long long m_batchedFinds = 0;
+    long long m_accepted = 0;
+};
+
+// Name - onSignal(int)
+// Desc - asks the event loop to stop
+void onSignal(int){
+    g_stop = 1;
+}
+
+// Name - setNonBlocking(int fd)
+// Desc - makes reads and writes on fd return EAGAIN instead of blocking
+bool setNonBlocking(int fd){
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// Name - run(int listenFd)
+// Desc - the event loop, one round per epoll_wait
+int Server::run(int listenFd){
+    m_epoll = epoll_create1(0);
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = listenFd;
+    if (m_epoll < 0 || epoll_ctl(m_epoll, EPOLL_CTL_ADD, listenFd, &event) != 0){
+        perror("epoll");
+        return 1;
+    }
+    epoll_event events[MAX_EVENTS];
+    while (!g_stop){
+        int ready = epoll_wait(m_epoll, events, MAX_EVENTS, STOP_CHECK_MS);
+        if (ready < 0){
+            if (errno == EINTR) continue;
+            perror("epoll_wait");
+            return 1;
+        }
+        m_round.clear();
+        for (int i = 0; i < ready; i++){
+            if (events[i].data.fd == listenFd){
+                accept(listenFd);
+                continue;
+            }
+            Connection* conn = m_connections[events[i].data.fd];
+            // a connection over the cap only gets EPOLLOUT, sending first lets it take requests again
+            if ((events[i].events & EPOLLOUT) && !writeTo(conn)){
+                continue;
+            }
+            if (!conn->touched){
+                conn->touched = true;
+                m_round.push_back(conn);
+            }
+            if (conn->unsent() < MAX_UNSENT){
+                if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)){
+                    readFrom(conn);
+                }
+                handle(conn);
+            }
+        }
+        // answer the finds of the round, then send everything
+        flushFinds();
+        for (size_t i = 0; i < m_round.size(); i++){
+            m_round[i]->touched = false;
+            writeTo(m_round[i]);
+        }
+    }
+    for (auto entry : m_connections){
+        close(entry.first);
+        delete entry.second;
+    }
+    m_connections.clear();
+    close(m_epoll);
+    return 0;
+}
+
+// Name - accept(int listenFd)
+// Desc - accepts every waiting client
+void Server::accept(int listenFd){
+    while (true){
+        int fd = ::accept(listenFd, nullptr, nullptr);
+        if (fd < 0){
+            return;
+        }
+        setNonBlocking(fd);
+        Connection* conn = new Connection();
+        conn->fd = fd;
+        m_connections[fd] = conn;
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        epoll_ctl(m_epoll, EPOLL_CTL_ADD, fd, &event);
+        m_accepted++;
+    }
+}
+
+// Name - readFrom(Connection* conn)
+// Desc - appends what the client has sent so far to its input, at most MAX_UNSENT unparsed bytes
+void Server::readFrom(Connection* conn){
+    // drop the bytes parsed in earlier rounds
+    if (conn->inPos > 0){
+        conn->in.erase(conn->in.begin(), conn->in.begin() + conn->inPos);
+        conn->inPos = 0;
+    }
+    unsigned char buffer[READ_SIZE];
+    while (conn->in.size() < MAX_UNSENT){
+        ssize_t got = read(conn->fd, buffer, READ_SIZE);
+        if (got > 0){
+            conn->in.insert(conn->in.end(), buffer, buffer + got);
+        }
+        else if (got == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)){
+            conn->closing = true;
+            return;
+        }
+        else if (errno != EINTR){
+            return;
+        }
+    }
+}
+
+// Name - handle(Connection* conn)
+// Desc - Handles every complete request in the input, finds are queued for the batched lookup. Stops
+// once MAX_UNSENT bytes of output are waiting and leaves the rest for when they are sent.
+void Server::handle(Connection* conn){
+    conn->held = false;
+    while (conn->inPos < conn->in.size()){
+        if (conn->unsent() >= MAX_UNSENT){
+            conn->held = true;
+            return;
+        }
+        const unsigned char* request = conn->in.data() + conn->inPos;
+        int op = request[0];
+        int size = requestSize(op);
+        if (size < 0){
+            conn->closing = true;
+            conn->inPos = conn->in.size();
+            return;
+        }
+        if (conn->in.size() - conn->inPos < size_t(size)){
+            return;
+        }
+        conn->inPos += size;
+        m_requests++;
+        if (op == REQ_FIND){
+            PendingFind find;
+            find.id = getID(request + 1);
+            find.conn = conn;
+            find.pos = conn->out.size();
+            conn->out.push_back(0);
+            m_finds.push_back(find);
+            continue;
+        }
+        // every other request sees the finds before it answered
+        flushFinds();
+        bool done = false;
+        switch (op){
+            case REQ_SETSTATE:
+                done = request[9] <= DECAYING && m_network.setState(getID(request + 1), static_cast<STATE>(request[9]));
+                conn->out.push_back(done);
+                break;
+            case REQ_INSERT: {
+                unsigned char attributes = request[9];
+                Sat satellite(getID(request + 1), static_cast<ALT>(attributes & 3),
+                              static_cast<INCLIN>((attributes >> 2) & 3), static_cast<STATE>((attributes >> 4) & 3));
+                conn->out.push_back(satellite.getState() <= DECAYING && m_network.insert(satellite) != nullptr);
+                break;
+            }
+            case REQ_REMOVE: {
+                int before = m_network.size();
+                m_network.remove(getID(request + 1));
+                conn->out.push_back(m_network.size() < before);
+                break;
+            }
+            case REQ_COUNT:
+                conn->out.push_back(request[1] <= I97);
+                putInt(request[1] <= I97 ? m_network.countSatellites(static_cast<INCLIN>(request[1])) : 0, conn->out);
+                break;
+            case REQ_LIST: {
+                vector<Sat> satellites;
+                m_network.getSatellites(satellites);
+                conn->out.push_back(1);
+                putInt(satellites.size(), conn->out);
+                for (size_t i = 0; i < satellites.size(); i++){
+                    putID(satellites[i].getID(), conn->out);
+                    conn->out.push_back(packAttributes(satellites[i].getAlt(), satellites[i].getInclin(), satellites[i].getState()));
+                }
+                break;
+            }
+            case REQ_REMOVEDEORBITED:
+                m_network.removeDeorbited();
+                conn->out.push_back(1);
+                break;
+        }
+    }
+}
+
+// Name - flushFinds()
+// Desc - answers every queued find with one sorted findSatellites traversal
+void Server::flushFinds(){
+    if (m_finds.empty()){
+        return;
+    }
+    sort(m_finds.begin(), m_finds.end());
+    m_ids.resize(m_finds.size());
+    for (size_t i = 0; i < m_finds.size(); i++){
+        m_ids[i] = m_finds[i].id;
+    }
+    m_network.findSatellites(m_ids, m_found);
+    for (size_t i = 0; i < m_finds.size(); i++){
+        m_finds[i].conn->out[m_finds[i].pos] = m_found[i];
+    }
+    m_batches++;
+    m_batchedFinds += m_finds.size();
+    m_finds.clear();
+}
+
+// Name - writeTo(Connection* conn)
+// Desc - Sends as much of the output as the socket takes and waits for EPOLLOUT for the rest, or for
+// a held connection to take its requests again. Only waits for EPOLLIN below the cap. False if the
+// connection was closed.
+bool Server::writeTo(Connection* conn){
+    while (conn->outPos < conn->out.size()){
+        ssize_t sent = write(conn->fd, conn->out.data() + conn->outPos, conn->out.size() - conn->outPos);
+        if (sent > 0){
+            conn->outPos += sent;
+        }
+        else if (sent < 0 && errno == EINTR){
+            continue;
+        }
+        else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)){
+            break;
+        }
+        else {
+            closeConnection(conn);
+            return false;
+        }
+    }
+    bool pending = conn->outPos < conn->out.size();
+    if (!pending){
+        conn->out.clear();
+        conn->outPos = 0;
+        if (conn->closing && !conn->held){
+            closeConnection(conn);
+            return false;
+        }
+    }
+    // the sent bytes of a connection that never drains are dropped so its output stays near the cap
+    else if (conn->outPos >= MAX_UNSENT){
+        conn->out.erase(conn->out.begin(), conn->out.begin() + conn->outPos);
+        conn->outPos = 0;
+    }
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = (pending || conn->held ? EPOLLOUT : 0) | (conn->unsent() < MAX_UNSENT ? EPOLLIN : 0);
+    event.data.fd = conn->fd;
+    epoll_ctl(m_epoll, EPOLL_CTL_MOD, conn->fd, &event);
+    return true;
+}
+
+// Name - closeConnection(Connection* conn)
+// Desc - closes the socket and forgets the connection
+void Server::closeConnection(Connection* conn){
+    epoll_ctl(m_epoll, EPOLL_CTL_DEL, conn->fd, nullptr);
+    close(conn->fd);
+    m_connections.erase(conn->fd);
+    delete conn;
+}
+
+// Name - report()
+// Desc - prints what the server did
+void Server::report() const {
+    cout << m_accepted << " connections, " << m_requests << " requests, " << m_batchedFinds << " finds in "
+         << m_batches << " batches (" << (m_batches > 0 ? double(m_batchedFinds) / m_batches : 0) << " per batch)" << endl;
+    cout << m_network.latency().toText();
+}
+
+// Name - listenOn(const string& kind, const string& address)
+// Desc - creates the non-blocking listening socket, -1 on failure
+int listenOn(const string& kind, const string& address){
+    int fd = -1;
+    if (kind == "unix"){
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, address.c_str(), sizeof(addr.sun_path) - 1);
+        unlink(address.c_str());
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || bind(fd, (sockaddr*)&addr, sizeof(addr)) != 0){
+            return -1;
+        }
+    }
+    else {
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(atoi(address.c_str()));
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (fd < 0 || bind(fd, (sockaddr*)&addr, sizeof(addr)) != 0){
+            return -1;
+        }
+    }
+    if (listen(fd, SOMAXCONN) != 0 || !setNonBlocking(fd)){
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int main(int argc, char* argv[]){
+    if (argc < 3 || (string(argv[1]) != "unix" && string(argv[1]) != "tcp")){
+        cout << "Usage: ./server unix <path> [keys] | ./server tcp <port> [keys]" << endl;
+        return 1;
+    }
+    int keys = DEFAULT_KEYS;
+    if (argc > 3) keys = atoi(argv[3]);
+
+    // the same catalog as loadgen's workload with the same number of keys
+    Workload workload(WorkloadMix(), keys > 0 ? keys : 1);
+    SatNet network(MINID, workload.maxID());
+    if (keys > 0){
+        vector<TraceOp> ops;
+        workload.load(ops);
+        replayTrace(network, ops);
+    }
+    network.setLatencySampling(16);
+
+    int listenFd = listenOn(argv[1], argv[2]);
+    if (listenFd < 0){
+        perror("listen");
+        return 1;
+    }
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+    cout << "Serving " << network.size() << " satellites on " << argv[1] << " " << argv[2] << endl;
+
+    Server server(network);
+    int result = server.run(listenFd);
+    close(listenFd);
+    if (string(argv[1]) == "unix"){
+        unlink(argv[2]);
+    }
+    server.report();
+    return result;
+}
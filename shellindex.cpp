@@ -0,0 +1,93 @@
+// Title: shellindex.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for shellindex.h
+
+#include "shellindex.h"
+
+// Name - ShellIndex()
+// Desc - empty shells that use ordered sets until setRange is called
+ShellIndex::ShellIndex(){
+    m_bitmaps = false;
+    for (int shell = 0; shell < NUM_SHELLS; shell++){
+        m_counts[shell] = 0;
+    }
+}
+
+// Name - setRange(int64_t low, int64_t high)
+// Desc - empties every shell and picks bitmaps or sets for the range
+void ShellIndex::setRange(int64_t low, int64_t high){
+    // the difference is taken unsigned so the whole 64-bit range doesn't overflow
+    m_bitmaps = low <= high && uint64_t(high) - uint64_t(low) < uint64_t(MAX_SHELL_UNIVERSE);
+    for (int shell = 0; shell < NUM_SHELLS; shell++){
+        // a range with low > high turns the bitmap off
+        m_ids[shell].setRange(m_bitmaps ? low : 1, m_bitmaps ? high : 0);
+        m_sets[shell].clear();
+        m_counts[shell] = 0;
+    }
+}
+
+// Name - insert(int shell, int64_t id)
+// Desc - adds the id to the shell, an id that is already there isn't counted again
+void ShellIndex::insert(int shell, int64_t id){
+    if (m_bitmaps){
+        if (!m_ids[shell].contains(id)){
+            m_ids[shell].insert(id);
+            m_counts[shell]++;
+        }
+    }
+    else if (m_sets[shell].insert(id).second){
+        m_counts[shell]++;
+    }
+}
+
+// Name - remove(int shell, int64_t id)
+// Desc - takes the id out of the shell if it is there
+void ShellIndex::remove(int shell, int64_t id){
+    if (m_bitmaps){
+        if (m_ids[shell].contains(id)){
+            m_ids[shell].remove(id);
+            m_counts[shell]--;
+        }
+    }
+    else if (m_sets[shell].erase(id) > 0){
+        m_counts[shell]--;
+    }
+}
+
+// Name - clear()
+// Desc - empties every shell, the bitmaps are kept for the next inserts and the empty ones aren't touched
+void ShellIndex::clear(){
+    for (int shell = 0; shell < NUM_SHELLS; shell++){
+        if (m_counts[shell] == 0){
+            continue;
+        }
+        m_ids[shell].clear();
+        m_sets[shell].clear();
+        m_counts[shell] = 0;
+    }
+}
+
+// Name - list(int shell, int64_t low, int64_t high, vector<int64_t>& ids)
+// Desc - walks the shell from the first id >= low up to high
+void ShellIndex::list(int shell, int64_t low, int64_t high, vector<int64_t>& ids) const {
+    if (low > high){
+        return;
+    }
+    if (!m_bitmaps){
+        const set<int64_t>& shellIDs = m_sets[shell];
+        for (auto it = shellIDs.lower_bound(low); it != shellIDs.end() && *it <= high; ++it){
+            ids.push_back(*it);
+        }
+        return;
+    }
+    int64_t id = 0;
+    int64_t from = low;
+    while (m_ids[shell].next(from, id) && id <= high){
+        ids.push_back(id);
+        if (id == high){
+            return;
+        }
+        from = id + 1;
+    }
+}
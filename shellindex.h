@@ -0,0 +1,43 @@
+// Title: shellindex.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: A secondary index of the live ids of a SatNet by orbital shell, one of the 16
+// combinations of altitude and inclination (shell = alt * 4 + inclin, see SatNet::shellOf).
+//
+// Every shell keeps a count and its own IdIndex bitmap over the network's id range, so a shell is
+// counted in O(1), listed in id order in O(k) and a range of ids within it is found by starting the
+// bitmap walk at the low end. Insert and remove only set or clear a few bits, and SatNet's bulk
+// operations insert and remove only the satellites they touch, so the shells are never refilled. A
+// shell's bitmap is allocated by its first insert and clear skips the empty shells. The 16 bitmaps are only
+// used for ranges up to MAX_SHELL_UNIVERSE ids (about 11 KB each for the default range), wider ranges
+// keep each shell in an ordered set instead.
+
+#ifndef SHELLINDEX_H
+#define SHELLINDEX_H
+#include <cstdint>
+#include <set>
+#include <vector>
+#include "idindex.h"
+using namespace std;
+
+const int NUM_SHELLS = 16;
+#define MAX_SHELL_UNIVERSE (1 << 20)  // the widest id range the shells keep bitmaps for, 128 KB per shell
+
+class ShellIndex{
+    public:
+    ShellIndex();
+    // empties every shell, the shells use bitmaps if the range low - high is narrow enough
+    void setRange(int64_t low, int64_t high);
+    void insert(int shell, int64_t id);
+    void remove(int shell, int64_t id);
+    void clear();
+    int count(int shell) const {return m_counts[shell];}
+    // appends the ids of the shell in [low, high] in ascending order
+    void list(int shell, int64_t low, int64_t high, vector<int64_t>& ids) const;
+    private:
+    bool m_bitmaps;                     //true if the shells use m_ids, false for m_sets
+    int m_counts[NUM_SHELLS];           //the number of ids in each shell
+    IdIndex m_ids[NUM_SHELLS];          //the ids of each shell for a narrow range
+    set<int64_t> m_sets[NUM_SHELLS];    //the ids of each shell for a wide range
+};
+#endif
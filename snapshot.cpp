@@ -0,0 +1,169 @@
+// Title: snapshot.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for snapshot.h
+
+#include "snapshot.h"
+#include "catalog.h"
+#include <chrono>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Name - writeSubtree(const Sat* node, CatalogWriter& writer, int fd, long long& written, bool& failed)
+// Desc - writes the live satellites of the subtree in order, reporting the progress through fd
+static void writeSubtree(const Sat* node, CatalogWriter& writer, int fd, long long& written, bool& failed){
+    if (node == nullptr){
+        return;
+    }
+    writeSubtree(node->getLeft(), writer, fd, written, failed);
+    if (!node->isDeleted()){
+        writer.add(*node);
+        written++;
+        // 8 bytes are less than PIPE_BUF, so a report is never split
+        if (written % SNAPSHOT_PROGRESS_STEP == 0 && write(fd, &written, sizeof(written)) != sizeof(written)){
+            failed = true;
+        }
+    }
+    writeSubtree(node->getRight(), writer, fd, written, failed);
+}
+
+// Name - writeSnapshot(const Sat* root, const string& fileName, int fd)
+// Desc - the child's work, writes the temporary file, syncs it and renames it over fileName. A
+// temporary file that couldn't be finished is deleted.
+static bool writeSnapshot(const Sat* root, const string& fileName, int fd){
+    string tempName = fileName + ".tmp";
+    CatalogWriter writer;
+    if (!writer.open(tempName)){
+        return false;
+    }
+    long long written = 0;
+    bool failed = false;
+    writeSubtree(root, writer, fd, written, failed);
+    failed = !writer.close() || failed;
+    int file = failed ? -1 : open(tempName.c_str(), O_RDONLY);
+    bool synced = file >= 0 && fsync(file) == 0;
+    if (file >= 0){
+        close(file);
+    }
+    if (!synced || rename(tempName.c_str(), fileName.c_str()) != 0){
+        unlink(tempName.c_str());
+        return false;
+    }
+    return write(fd, &written, sizeof(written)) == sizeof(written);
+}
+
+// Name - ForkSnapshot()
+// Desc - an idle snapshot without a child
+ForkSnapshot::ForkSnapshot(){
+    m_child = -1;
+    m_pipe = -1;
+    m_status = SNAP_IDLE;
+    m_written = 0;
+    m_total = 0;
+    m_pauseNs = 0;
+}
+
+// Name - ~ForkSnapshot()
+// Desc - waits for a running child so it isn't left as a zombie
+ForkSnapshot::~ForkSnapshot(){
+    wait();
+}
+
+// Name - start(const SatNet& network, const string& fileName)
+// Desc - Forks the child that writes the snapshot and returns right away. The child never returns
+// from here, it leaves with _exit so it doesn't run the parent's destructors or flush its buffers.
+bool ForkSnapshot::start(const SatNet& network, const string& fileName){
+    if (m_status == SNAP_RUNNING){
+        return false;
+    }
+    int fds[2];
+    if (pipe(fds) != 0){
+        return false;
+    }
+    auto begin = chrono::steady_clock::now();
+    pid_t child = fork();
+    if (child == 0){
+        ::close(fds[0]);
+        bool written = writeSnapshot(network.m_root, fileName, fds[1]);
+        _exit(written ? 0 : 1);
+    }
+    m_pauseNs = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - begin).count();
+    ::close(fds[1]);
+    if (child < 0){
+        ::close(fds[0]);
+        return false;
+    }
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+    m_child = child;
+    m_pipe = fds[0];
+    m_status = SNAP_RUNNING;
+    m_written = 0;
+    m_total = network.size();
+    return true;
+}
+
+// Name - readProgress()
+// Desc - keeps the newest count of the reports waiting in the pipe
+void ForkSnapshot::readProgress(){
+    long long reports[64];
+    ssize_t got = 0;
+    while ((got = read(m_pipe, reports, sizeof(reports))) > 0){
+        m_written = reports[got / sizeof(long long) - 1];
+    }
+}
+
+// Name - finish(int exitStatus)
+// Desc - reads the last reports and decides if the child wrote the whole snapshot
+void ForkSnapshot::finish(int exitStatus){
+    readProgress();
+    ::close(m_pipe);
+    m_pipe = -1;
+    m_child = -1;
+    bool done = WIFEXITED(exitStatus) && WEXITSTATUS(exitStatus) == 0 && m_written == m_total;
+    m_status = done ? SNAP_DONE : SNAP_FAILED;
+}
+
+// Name - poll()
+// Desc - updates the progress and the status without blocking
+SNAPSTATUS ForkSnapshot::poll(){
+    if (m_status != SNAP_RUNNING){
+        return m_status;
+    }
+    readProgress();
+    int exitStatus = 0;
+    if (waitpid(m_child, &exitStatus, WNOHANG) == m_child){
+        finish(exitStatus);
+    }
+    return m_status;
+}
+
+// Name - wait()
+// Desc - waits for the child to exit and returns how it went
+SNAPSTATUS ForkSnapshot::wait(){
+    if (m_status != SNAP_RUNNING){
+        return m_status;
+    }
+    int exitStatus = 0;
+    if (waitpid(m_child, &exitStatus, 0) != m_child){
+        exitStatus = 1 << 8;
+    }
+    finish(exitStatus);
+    return m_status;
+}
+
+// Name - getProgress()
+// Desc - the fraction of the satellites written so far
+double ForkSnapshot::getProgress() const {
+    if (m_total == 0){
+        return m_status == SNAP_DONE || m_status == SNAP_RUNNING ? 1 : 0;
+    }
+    return double(m_written) / m_total;
+}
+
+// Name - loadSnapshot(const string& fileName, SatNet& network)
+// Desc - a snapshot is a catalog file, see loadCatalog
+bool loadSnapshot(const string& fileName, SatNet& network){
+    return loadCatalog(fileName, network);
+}
@@ -0,0 +1,56 @@
+// Title: snapshot.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: Background snapshots of a SatNet taken with fork().
+//
+// start() forks the process. The child sees the network exactly as it was at the fork through the
+// copy-on-write pages it shares with the parent, writes every live satellite to the snapshot file
+// and exits, while the parent goes on changing the network. Only the pages the parent writes to are
+// copied, so the parent's pause is the fork itself, which copies the page tables and not the tree.
+// The child reports the number of satellites written through a pipe every SNAPSHOT_PROGRESS_STEP
+// satellites and once more at the end, the parent reads them with poll() or wait().
+//
+// A snapshot is a compressed catalog (see catalog.h) written to fileName.tmp, synced and renamed, so
+// fileName is either the old snapshot or the whole new one. loadSnapshot reads it back. The network
+// must not be changed by another thread while start() forks.
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+#include "satnet.h"
+#include <string>
+#include <sys/types.h>
+using namespace std;
+
+#define SNAPSHOT_PROGRESS_STEP 65536    // satellites written between two progress reports
+
+enum SNAPSTATUS {SNAP_IDLE, SNAP_RUNNING, SNAP_DONE, SNAP_FAILED};
+
+class ForkSnapshot{
+    public:
+    ForkSnapshot();
+    ~ForkSnapshot();// waits for a running child
+    ForkSnapshot(const ForkSnapshot&) = delete;
+    ForkSnapshot& operator=(const ForkSnapshot&) = delete;
+    // forks a child that writes network to fileName, false if a snapshot is running or fork fails
+    bool start(const SatNet& network, const string& fileName);
+    SNAPSTATUS poll();// reads the progress reports that arrived without blocking
+    SNAPSTATUS wait();// blocks until the child is done
+    SNAPSTATUS getStatus() const {return m_status;}
+    long long getWritten() const {return m_written;}// satellites the child reported as written
+    long long getTotal() const {return m_total;}// satellites in the network when it was forked
+    double getProgress() const;// getWritten() / getTotal(), 1 for an empty network
+    long long getPauseNs() const {return m_pauseNs;}// how long start() held up the caller
+    private:
+    void readProgress();
+    void finish(int exitStatus);
+    pid_t m_child;
+    int m_pipe;             //the read end of the progress pipe, -1 without a child
+    SNAPSTATUS m_status;
+    long long m_written;
+    long long m_total;
+    long long m_pauseNs;
+};
+
+// replaces network with the satellites of a snapshot file, false if it can't be read or isn't a snapshot
+bool loadSnapshot(const string& fileName, SatNet& network);
+#endif
@@ -0,0 +1,148 @@
+// Title: taskpool.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for taskpool.h
+
+#include "taskpool.h"
+
+// the pool and deque of the current thread, set for workers and for callers inside forkJoin
+static thread_local const TaskPool* t_pool = nullptr;
+static thread_local int t_index = -1;
+
+// Name - TaskPool(int threads)
+// Desc - starts threads - 1 workers, the thread calling forkJoin is the last one
+TaskPool::TaskPool(int threads) : m_queues(threads > 0 ? threads : max(1u, thread::hardware_concurrency())) {
+    m_threads = m_queues.size();
+    m_pending = 0;
+    m_stop = false;
+    m_steals = 0;
+    for (int i = 0; i < m_threads - 1; i++){
+        m_workers.push_back(thread(&TaskPool::workerLoop, this, i));
+    }
+}
+
+// Name - ~TaskPool()
+// Desc - wakes the workers and waits for them to exit
+TaskPool::~TaskPool(){
+    m_stop = true;
+    {
+        lock_guard<mutex> guard(m_sleepLock);
+    }
+    m_wake.notify_all();
+    for (size_t i = 0; i < m_workers.size(); i++){
+        m_workers[i].join();
+    }
+}
+
+// Name - workerLoop(int index)
+// Desc - runs tasks until the pool is destroyed, sleeping while every deque is empty
+void TaskPool::workerLoop(int index){
+    t_pool = this;
+    t_index = index;
+    while (!m_stop){
+        if (!runOne(index)){
+            unique_lock<mutex> sleep(m_sleepLock);
+            m_wake.wait(sleep, [this]{return m_stop || m_pending > 0;});
+        }
+    }
+}
+
+// Name - queueIndex()
+// Desc - the deque a worker owns, or the shared deque of the threads outside the pool
+int TaskPool::queueIndex(){
+    return t_pool == this ? t_index : m_threads - 1;
+}
+
+// Name - forkJoin(const function<void()>& first, const function<void()>& second)
+// Desc - Makes second available to the other workers, runs first and then runs second too unless it
+// was stolen, in which case this thread helps with other tasks until the thief is done.
+void TaskPool::forkJoin(const function<void()>& first, const function<void()>& second){
+    if (m_threads == 1){
+        first();
+        second();
+        return;
+    }
+    // a thread outside the pool takes the shared deque for the whole call, nested forks are inside it
+    if (t_pool != this){
+        lock_guard<mutex> guard(m_external);
+        const TaskPool* oldPool = t_pool;
+        int oldIndex = t_index;
+        t_pool = this;
+        t_index = m_threads - 1;
+        forkJoin(first, second);
+        t_pool = oldPool;
+        t_index = oldIndex;
+        return;
+    }
+    int index = queueIndex();
+    Task task;
+    task.work = &second;
+    {
+        lock_guard<mutex> guard(m_queues[index].lock);
+        m_queues[index].tasks.push_back(&task);
+    }
+    m_pending++;
+    {
+        lock_guard<mutex> guard(m_sleepLock);
+    }
+    m_wake.notify_one();
+
+    first();
+    if (popOwn(index, &task)){
+        second();
+        return;
+    }
+    while (!task.done.load(memory_order_acquire)){
+        if (!runOne(index)){
+            this_thread::yield();
+        }
+    }
+}
+
+// Name - popOwn(int index, Task* expected)
+// Desc - takes the task back from the back of the own deque if it is still there
+bool TaskPool::popOwn(int index, Task* expected){
+    lock_guard<mutex> guard(m_queues[index].lock);
+    deque<Task*>& tasks = m_queues[index].tasks;
+    if (tasks.empty() || tasks.back() != expected){
+        return false;
+    }
+    tasks.pop_back();
+    m_pending--;
+    return true;
+}
+
+// Name - runOne(int index)
+// Desc - runs the newest task of the own deque, or steals the oldest task of another deque
+bool TaskPool::runOne(int index){
+    Task* task = nullptr;
+    {
+        lock_guard<mutex> guard(m_queues[index].lock);
+        if (!m_queues[index].tasks.empty()){
+            task = m_queues[index].tasks.back();
+            m_queues[index].tasks.pop_back();
+        }
+    }
+    for (int i = 1; task == nullptr && i < m_threads; i++){
+        Queue& victim = m_queues[(index + i) % m_threads];
+        lock_guard<mutex> guard(victim.lock);
+        if (!victim.tasks.empty()){
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            m_steals.fetch_add(1, memory_order_relaxed);
+        }
+    }
+    if (task == nullptr){
+        return false;
+    }
+    m_pending--;
+    run(task);
+    return true;
+}
+
+// Name - run(Task* task)
+// Desc - runs a task and marks it done, the task lives on the stack of its forking thread
+void TaskPool::run(Task* task){
+    (*task->work)();
+    task->done.store(true, memory_order_release);
+}
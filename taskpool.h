@@ -0,0 +1,64 @@
+// Title: taskpool.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: A small work-stealing thread pool for fork-join recursion, used by the parallel
+// SatNet set operations.
+//
+// Every worker owns a deque of tasks. A fork pushes one half of the work onto the back of the
+// caller's deque and runs the other half itself, idle workers steal from the front of the other
+// deques, so they take the oldest and largest pieces of a recursion. A thread waiting for a join
+// keeps running tasks instead of blocking, which makes nested forks safe.
+
+#ifndef TASKPOOL_H
+#define TASKPOOL_H
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+class TaskPool{
+    public:
+    // threads counts the calling thread, 0 uses every hardware thread and 1 runs everything inline
+    explicit TaskPool(int threads = 0);
+    ~TaskPool();
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+    int getThreads() const {return m_threads;}
+    // runs first and second in parallel and returns when both are done
+    void forkJoin(const function<void()>& first, const function<void()>& second);
+    // the number of tasks that ran on another thread than the one that forked them
+    long long getSteals() const {return m_steals.load(memory_order_relaxed);}
+
+    private:
+    struct Task{
+        const function<void()>* work;
+        atomic<bool> done{false};
+    };
+    // a deque of forked tasks guarded by its own lock, the owner works at the back
+    struct Queue{
+        mutex lock;
+        deque<Task*> tasks;
+    };
+    void workerLoop(int index);
+    int queueIndex();       // the deque of the current thread
+    bool popOwn(int index, Task* expected);// takes expected back if nobody stole it yet
+    bool runOne(int index); // runs a task of any deque, false if there was none
+    void run(Task* task);
+
+    int m_threads;
+    vector<thread> m_workers;
+    // one deque per worker plus the last one for threads outside the pool, m_external serializes those
+    vector<Queue> m_queues;
+    mutex m_external;
+    mutex m_sleepLock;
+    condition_variable m_wake;
+    atomic<int> m_pending;  //tasks waiting in the deques
+    atomic<bool> m_stop;
+    atomic<long long> m_steals;
+};
+#endif
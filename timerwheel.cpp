@@ -0,0 +1,215 @@
+// Title: timerwheel.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for timerwheel.h
+
+#include "timerwheel.h"
+
+// Name - TimerWheel()
+// Desc - an empty wheel at time 0
+TimerWheel::TimerWheel(){
+    m_free = -1;
+    m_due = -1;
+    m_time = 0;
+    for (int level = 0; level < WHEEL_LEVELS; level++){
+        m_occupied[level] = 0;
+        for (int slot = 0; slot < WHEEL_SLOTS; slot++){
+            m_slots[level][slot] = -1;
+        }
+    }
+}
+
+// Name - schedule(int64_t id, long long deadline)
+// Desc - takes a timer from the pool and places it, negative deadlines count as 0
+void TimerWheel::schedule(int64_t id, long long deadline){
+    cancel(id);
+    int timer = m_free;
+    if (timer >= 0){
+        m_free = m_timers[timer].next;
+    }
+    else {
+        timer = m_timers.size();
+        m_timers.push_back(Timer());
+    }
+    m_timers[timer].id = id;
+    m_timers[timer].deadline = deadline < 0 ? 0 : uint64_t(deadline);
+    m_byID[id] = timer;
+    place(timer);
+}
+
+// Name - cancel(int64_t id)
+// Desc - unlinks id's timer and returns it to the pool
+bool TimerWheel::cancel(int64_t id){
+    auto found = m_byID.find(id);
+    if (found == m_byID.end()){
+        return false;
+    }
+    int timer = found->second;
+    m_byID.erase(found);
+    unlink(timer);
+    release(timer);
+    return true;
+}
+
+// Name - getDeadline(int64_t id, long long& deadline)
+// Desc - sets deadline to the deadline of id's timer, false if it has none
+bool TimerWheel::getDeadline(int64_t id, long long& deadline) const {
+    auto found = m_byID.find(id);
+    if (found == m_byID.end()){
+        return false;
+    }
+    deadline = m_timers[found->second].deadline;
+    return true;
+}
+
+// Name - advance(long long now, vector<int64_t>& expired)
+// Desc - Processes only the ticks that have a slot with timers, found with nextTick. At such a tick
+// the higher levels' slots for it are moved down first, top level first, since a timer can move into
+// a lower slot of the same tick, then the level 0 slot expires. The due list expires last.
+void TimerWheel::advance(long long now, vector<int64_t>& expired){
+    uint64_t target = now < 0 ? 0 : uint64_t(now);
+    while (m_byID.size() > 0){
+        uint64_t tick = nextTick();
+        if (tick > target){
+            break;
+        }
+        m_time = tick;
+        for (int level = WHEEL_LEVELS - 1; level > 0; level--){
+            uint64_t below = (uint64_t(1) << (WHEEL_BITS * level)) - 1;
+            if ((tick & below) != 0){
+                continue;
+            }
+            int slot = (tick >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+            int timer = m_slots[level][slot];
+            m_slots[level][slot] = -1;
+            m_occupied[level] &= ~(uint64_t(1) << slot);
+            while (timer >= 0){
+                int next = m_timers[timer].next;
+                place(timer);
+                timer = next;
+            }
+        }
+        int slot = tick & (WHEEL_SLOTS - 1);
+        int head = m_slots[0][slot];
+        m_slots[0][slot] = -1;
+        m_occupied[0] &= ~(uint64_t(1) << slot);
+        expire(head, expired);
+    }
+    if (target > m_time){
+        m_time = target;
+    }
+    int head = m_due;
+    m_due = -1;
+    expire(head, expired);
+}
+
+// Name - clear()
+// Desc - empties the slots and the pool
+void TimerWheel::clear(){
+    long long time = m_time;
+    *this = TimerWheel();
+    m_time = time;
+}
+
+// Name - getIDs(vector<int64_t>& ids)
+// Desc - appends every id that has a timer
+void TimerWheel::getIDs(vector<int64_t>& ids) const {
+    for (auto& entry : m_byID){
+        ids.push_back(entry.first);
+    }
+}
+
+// Name - place(int timer)
+// Desc - Links the timer into the lowest level where its deadline has the same digits as the current
+// time above that level, in the slot of its digit at that level. Its digit there is larger than the
+// time's, so the slot is reached before the deadline. A deadline that isn't after the time is due.
+void TimerWheel::place(int timer){
+    uint64_t deadline = m_timers[timer].deadline;
+    if (deadline <= m_time){
+        link(timer, -1, 0);
+        return;
+    }
+    int level = 0;
+    while (level < WHEEL_LEVELS - 1 && (deadline >> (WHEEL_BITS * (level + 1))) != (m_time >> (WHEEL_BITS * (level + 1)))){
+        level++;
+    }
+    link(timer, level, (deadline >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1));
+}
+
+// Name - link(int timer, int level, int slot)
+// Desc - pushes the timer on the front of a slot's list, level -1 is the due list
+void TimerWheel::link(int timer, int level, int slot){
+    int& head = level < 0 ? m_due : m_slots[level][slot];
+    Timer& entry = m_timers[timer];
+    entry.level = level;
+    entry.slot = slot;
+    entry.prev = -1;
+    entry.next = head;
+    if (head >= 0){
+        m_timers[head].prev = timer;
+    }
+    head = timer;
+    if (level >= 0){
+        m_occupied[level] |= uint64_t(1) << slot;
+    }
+}
+
+// Name - unlink(int timer)
+// Desc - takes the timer out of its slot's list, clearing the slot's bit if it was the last one
+void TimerWheel::unlink(int timer){
+    Timer& entry = m_timers[timer];
+    int& head = entry.level < 0 ? m_due : m_slots[entry.level][entry.slot];
+    if (entry.prev >= 0){
+        m_timers[entry.prev].next = entry.next;
+    }
+    else {
+        head = entry.next;
+    }
+    if (entry.next >= 0){
+        m_timers[entry.next].prev = entry.prev;
+    }
+    if (entry.level >= 0 && head < 0){
+        m_occupied[entry.level] &= ~(uint64_t(1) << entry.slot);
+    }
+}
+
+// Name - release(int timer)
+// Desc - returns an unlinked timer to the pool
+void TimerWheel::release(int timer){
+    m_timers[timer].next = m_free;
+    m_free = timer;
+}
+
+// Name - expire(int head, vector<int64_t>& expired)
+// Desc - appends the ids of a detached list of timers and returns them to the pool
+void TimerWheel::expire(int head, vector<int64_t>& expired){
+    while (head >= 0){
+        int next = m_timers[head].next;
+        expired.push_back(m_timers[head].id);
+        m_byID.erase(m_timers[head].id);
+        release(head);
+        head = next;
+    }
+}
+
+// Name - nextTick()
+// Desc - the earliest tick at which an occupied slot is processed, the first occupied slot of each
+// level within the time's current round of that level. UINT64_MAX if the wheel holds no slotted timers.
+uint64_t TimerWheel::nextTick() const {
+    uint64_t tick = UINT64_MAX;
+    for (int level = 0; level < WHEEL_LEVELS; level++){
+        if (m_occupied[level] == 0){
+            continue;
+        }
+        uint64_t round = 0;
+        if (level < WHEEL_LEVELS - 1){
+            int shift = WHEEL_BITS * (level + 1);
+            round = (m_time >> shift) << shift;
+        }
+        uint64_t start = round | (uint64_t(__builtin_ctzll(m_occupied[level])) << (WHEEL_BITS * level));
+        if (start < tick){
+            tick = start;
+        }
+    }
+    return tick;
+}
@@ -0,0 +1,64 @@
+// Title: timerwheel.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: A hierarchical timer wheel of deadlines keyed by satellite id, used by SatNet to move
+// DECAYING satellites to DEORBITED when their deadline passes without scanning the tree.
+//
+// Time is a count of ticks in whatever unit the caller picks. Level L of the wheel has WHEEL_SLOTS
+// slots of WHEEL_SLOTS^L ticks each, so a timer sits in the lowest level where its deadline and the
+// current time agree on every higher digit, and WHEEL_LEVELS levels cover any 64-bit deadline. When
+// the time reaches a slot of a higher level its timers are moved down, each timer at most once per
+// level, and a level 0 slot holds exactly the timers due at its tick. A bitmap of the occupied slots of
+// every level lets advance() jump straight to the next tick with work to do. Scheduling, cancelling
+// and expiring a timer are O(1), cancelling goes through a hash map from the id to its timer.
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+using namespace std;
+
+#define WHEEL_BITS 6                    // slots per level are 1 << WHEEL_BITS
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_LEVELS 11                 // 11 levels of 6 bits cover every 64-bit tick
+
+class TimerWheel{
+    public:
+    TimerWheel();
+    // gives id a timer at deadline, replacing its old one. A deadline that isn't after the current
+    // time is due at the next advance.
+    void schedule(int64_t id, long long deadline);
+    bool cancel(int64_t id);// false if id has no timer
+    bool getDeadline(int64_t id, long long& deadline) const;
+    // moves the time forward to now and appends the ids of every timer due by then, their timers are gone
+    void advance(long long now, vector<int64_t>& expired);
+    void clear();// drops every timer, the time is kept
+    void getIDs(vector<int64_t>& ids) const;// appends the ids with a timer in no particular order
+    int size() const {return m_byID.size();}
+    bool empty() const {return m_byID.empty();}
+    long long getTime() const {return m_time;}
+    private:
+    struct Timer{
+        int64_t id;
+        uint64_t deadline;
+        int prev;       //the neighbours in the slot's list, -1 at the ends
+        int next;
+        int level;      //-1 for the list of due timers
+        int slot;
+    };
+    void place(int timer);
+    void link(int timer, int level, int slot);
+    void unlink(int timer);
+    void release(int timer);
+    void expire(int head, vector<int64_t>& expired);
+    uint64_t nextTick() const;
+    vector<Timer> m_timers;             //the pool the slots' lists are linked through
+    int m_free;                         //the first unused timer of the pool, -1 if there is none
+    unordered_map<int64_t, int> m_byID;
+    int m_slots[WHEEL_LEVELS][WHEEL_SLOTS];     //the first timer of every slot, -1 if it is empty
+    uint64_t m_occupied[WHEEL_LEVELS];          //bit s is set if slot s of the level has timers
+    int m_due;                          //timers due at the next advance
+    uint64_t m_time;                    //every tick up to this one is processed
+};
+#endif
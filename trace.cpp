@@ -0,0 +1,297 @@
+// Title: trace.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for trace.h
+
+#include "trace.h"
+#include <chrono>
+#include <cstring>
+
+const char TRACE_MAGIC[] = "SATTRC2\n";
+const int TRACE_MAGIC_SIZE = 8;
+const int TRACE_RANGE_SIZE = 16;  // minID and maxID after the magic
+const size_t TRACE_BUFFER_SIZE = 1 << 16;
+
+// Name - operator==(const TraceOp& rhs)
+// Desc - two operations are equal if every field the record format stores is equal
+bool TraceOp::operator==(const TraceOp& rhs) const {
+    if (op != rhs.op){
+        return false;
+    }
+    switch (op){
+        case T_REMOVEDEORBITED: return true;
+        case T_FIND: case T_REMOVE: return id == rhs.id;
+        case T_SETSTATE: return id == rhs.id && state == rhs.state;
+        case T_INSERT: return id == rhs.id && alt == rhs.alt && inclin == rhs.inclin && state == rhs.state;
+    }
+    return false;
+}
+
+// Name - putRange(SatID minID, SatID maxID, unsigned char* out)
+// Desc - writes the id range of the header, little endian
+static void putRange(SatID minID, SatID maxID, unsigned char* out){
+    for (int i = 0; i < 8; i++){
+        out[i] = (uint64_t(minID) >> (8 * i)) & 0xFF;
+        out[8 + i] = (uint64_t(maxID) >> (8 * i)) & 0xFF;
+    }
+}
+
+// Name - getRange(const unsigned char* in, SatID& minID, SatID& maxID)
+// Desc - reads the id range written by putRange
+static void getRange(const unsigned char* in, SatID& minID, SatID& maxID){
+    uint64_t low = 0;
+    uint64_t high = 0;
+    for (int i = 7; i >= 0; i--){
+        low = (low << 8) | in[i];
+        high = (high << 8) | in[8 + i];
+    }
+    minID = SatID(low);
+    maxID = SatID(high);
+}
+
+// Name - TraceWriter()
+// Desc - creates a writer without a file
+TraceWriter::TraceWriter(){
+    m_file = nullptr;
+    m_lastID = 0;
+    m_count = 0;
+    m_failed = false;
+}
+
+// Name - ~TraceWriter()
+// Desc - flushes and closes the file
+TraceWriter::~TraceWriter(){
+    close();
+}
+
+// Name - open(const string& fileName, SatID minID, SatID maxID)
+// Desc - Creates or truncates the file and writes the magic and the id range, returns false if it
+// can't be opened. A network being recorded passes its getMinID() and getMaxID().
+bool TraceWriter::open(const string& fileName, SatID minID, SatID maxID){
+    close();
+    m_file = fopen(fileName.c_str(), "wb");
+    if (m_file == nullptr){
+        return false;
+    }
+    unsigned char range[TRACE_RANGE_SIZE];
+    putRange(minID, maxID, range);
+    m_failed = fwrite(TRACE_MAGIC, 1, TRACE_MAGIC_SIZE, m_file) != TRACE_MAGIC_SIZE ||
+               fwrite(range, 1, TRACE_RANGE_SIZE, m_file) != TRACE_RANGE_SIZE;
+    m_buffer.clear();
+    m_buffer.reserve(TRACE_BUFFER_SIZE);
+    m_lastID = 0;
+    m_count = 0;
+    return true;
+}
+
+// Name - write(const TraceOp& op)
+// Desc - appends one record to the buffer, the buffer is written out when it is full
+void TraceWriter::write(const TraceOp& op){
+    if (m_file == nullptr){
+        return;
+    }
+    encodeTraceOp(op, m_lastID, m_buffer);
+    m_count++;
+    if (m_buffer.size() >= TRACE_BUFFER_SIZE){
+        flush();
+    }
+}
+
+// Name - flush()
+// Desc - writes the buffered records to the file
+void TraceWriter::flush(){
+    if (m_file != nullptr && !m_buffer.empty()){
+        if (fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) != m_buffer.size()){
+            m_failed = true;
+        }
+        m_buffer.clear();
+    }
+}
+
+// Name - close()
+// Desc - flushes the buffer and closes the file, returns false if a write or the close failed
+bool TraceWriter::close(){
+    if (m_file == nullptr){
+        return !m_failed;
+    }
+    flush();
+    if (fclose(m_file) != 0){
+        m_failed = true;
+    }
+    m_file = nullptr;
+    return !m_failed;
+}
+
+// Name - TraceReader()
+// Desc - creates a reader without a file
+TraceReader::TraceReader(){
+    m_file = nullptr;
+    m_pos = 0;
+    m_size = 0;
+    m_lastID = 0;
+    m_minID = INT64_MIN;
+    m_maxID = INT64_MAX;
+}
+
+// Name - ~TraceReader()
+// Desc - closes the file
+TraceReader::~TraceReader(){
+    close();
+}
+
+// Name - open(const string& fileName)
+// Desc - opens a trace, checks the magic and reads the id range, returns false if the file is not a trace
+bool TraceReader::open(const string& fileName){
+    close();
+    m_file = fopen(fileName.c_str(), "rb");
+    if (m_file == nullptr){
+        return false;
+    }
+    m_buffer.resize(TRACE_BUFFER_SIZE);
+    m_pos = 0;
+    m_size = 0;
+    m_lastID = 0;
+    char magic[TRACE_MAGIC_SIZE];
+    unsigned char range[TRACE_RANGE_SIZE];
+    if (fread(magic, 1, TRACE_MAGIC_SIZE, m_file) != TRACE_MAGIC_SIZE || memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_SIZE) != 0 ||
+        fread(range, 1, TRACE_RANGE_SIZE, m_file) != TRACE_RANGE_SIZE){
+        close();
+        return false;
+    }
+    getRange(range, m_minID, m_maxID);
+    return true;
+}
+
+// Name - close()
+// Desc - closes the file
+void TraceReader::close(){
+    if (m_file != nullptr){
+        fclose(m_file);
+        m_file = nullptr;
+    }
+}
+
+// Name - refill()
+// Desc - reads the next chunk of the file into the buffer, false at the end of the file
+bool TraceReader::refill(){
+    if (m_file == nullptr){
+        return false;
+    }
+    m_size = fread(m_buffer.data(), 1, m_buffer.size(), m_file);
+    m_pos = 0;
+    return m_size > 0;
+}
+
+// Name - getByte()
+// Desc - the next byte of the trace or -1 at the end of the file
+int TraceReader::getByte(){
+    if (m_pos == m_size && !refill()){
+        return -1;
+    }
+    return m_buffer[m_pos++];
+}
+
+// Name - next(TraceOp& op)
+// Desc - decodes the next record, returns false at the end of the trace or on a broken record
+bool TraceReader::next(TraceOp& op){
+    return decodeTraceOp([this]{return getByte();}, m_lastID, op);
+}
+
+// Name - readTrace(const string& fileName, vector<TraceOp>& ops)
+// Desc - appends every operation of a trace to ops
+bool readTrace(const string& fileName, vector<TraceOp>& ops){
+    SatID minID;
+    SatID maxID;
+    return readTrace(fileName, ops, minID, maxID);
+}
+
+// Name - readTrace(const string& fileName, vector<TraceOp>& ops, SatID& minID, SatID& maxID)
+// Desc - appends every operation of a trace to ops and sets the id range it was recorded with
+bool readTrace(const string& fileName, vector<TraceOp>& ops, SatID& minID, SatID& maxID){
+    TraceReader reader;
+    if (!reader.open(fileName)){
+        return false;
+    }
+    minID = reader.getMinID();
+    maxID = reader.getMaxID();
+    TraceOp op;
+    while (reader.next(op)){
+        ops.push_back(op);
+    }
+    return true;
+}
+
+// Name - writeTrace(const string& fileName, const vector<TraceOp>& ops, SatID minID, SatID maxID)
+// Desc - writes ops as a new trace of a network with the range minID - maxID
+bool writeTrace(const string& fileName, const vector<TraceOp>& ops, SatID minID, SatID maxID){
+    TraceWriter writer;
+    if (!writer.open(fileName, minID, maxID)){
+        return false;
+    }
+    for (size_t i = 0; i < ops.size(); i++){
+        writer.write(ops[i]);
+    }
+    return writer.close();
+}
+
+// Name - applyTraceOp(SatNet& network, const TraceOp& op)
+// Desc - performs one operation on the network
+void applyTraceOp(SatNet& network, const TraceOp& op){
+    switch (op.op){
+        case T_FIND: network.findSatellite(op.id); break;
+        case T_SETSTATE: network.setState(op.id, op.state); break;
+        case T_INSERT: network.insert(Sat(op.id, op.alt, op.inclin, op.state)); break;
+        case T_REMOVE: network.remove(op.id); break;
+        case T_REMOVEDEORBITED: network.removeDeorbited(); break;
+    }
+}
+
+// Name - replayTrace(SatNet& network, const vector<TraceOp>& ops)
+// Desc - performs every operation in order, returns how long it took in ns
+long long replayTrace(SatNet& network, const vector<TraceOp>& ops){
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (size_t i = 0; i < ops.size(); i++){
+        applyTraceOp(network, ops[i]);
+    }
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+}
+
+// Name - traceOpStr(TRACEOP op)
+// Desc - the name of a trace operation
+string traceOpStr(TRACEOP op){
+    string text = "";
+    switch (op){
+        case T_FIND:text = "find";break;
+        case T_SETSTATE:text = "setState";break;
+        case T_INSERT:text = "insert";break;
+        case T_REMOVE:text = "remove";break;
+        case T_REMOVEDEORBITED:text = "removeDeorbited";break;
+        default:text = "UNKNOWN";break;
+    }
+    return text;
+}
+
+// Name - encodeTraceOp(const TraceOp& op, SatID& lastID, vector<unsigned char>& out)
+// Desc - appends the header byte, the attribute byte of an insert and the zigzag varint id delta
+void encodeTraceOp(const TraceOp& op, SatID& lastID, vector<unsigned char>& out){
+    unsigned char head = op.op;
+    if (op.op == T_SETSTATE){
+        head |= op.state << 3;
+    }
+    out.push_back(head);
+    if (op.op == T_INSERT){
+        out.push_back(op.alt | (op.inclin << 2) | (op.state << 4));
+    }
+    if (op.op != T_REMOVEDEORBITED){
+        // zigzag so that small negative differences also take few bytes, unsigned since ids more than
+        // 2^63 apart wrap around
+        uint64_t delta = uint64_t(op.id) - uint64_t(lastID);
+        uint64_t zigzag = (delta << 1) ^ (0 - (delta >> 63));
+        while (zigzag >= 0x80){
+            out.push_back((zigzag & 0x7F) | 0x80);
+            zigzag >>= 7;
+        }
+        out.push_back(zigzag);
+        lastID = op.id;
+    }
+}
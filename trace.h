@@ -0,0 +1,132 @@
+// Title: trace.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: Compact binary traces of SatNet operations so real traffic can be recorded and
+// replayed offline against any SatNet build.
+//
+// A trace file starts with the 8 byte magic "SATTRC2\n" and the id range of the recording network,
+// its minID and maxID as 8 byte little endian numbers, followed by one record per operation:
+//   byte 0       the operation in bits 0-2 and, for setState, the new state in bits 3-4
+//   byte 1       inserts only, the altitude in bits 0-1 and the inclination in bits 2-3 and the
+//                state in bits 4-5
+//   varint       every operation but removeDeorbited, the zigzag encoded difference between the
+//                id and the id of the previous record
+// Most records take 2 to 4 bytes. Replaying into a network with the recorded range rejects the same
+// out of range calls the recording network did.
+
+#ifndef TRACE_H
+#define TRACE_H
+#include "satnet.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+using namespace std;
+
+enum TRACEOP {T_FIND, T_SETSTATE, T_INSERT, T_REMOVE, T_REMOVEDEORBITED};
+const int NUM_TRACEOPS = 5;
+
+// one operation of a trace
+struct TraceOp{
+    TRACEOP op = T_FIND;
+    SatID id = DEFAULT_ID;
+    ALT alt = DEFAULT_ALT;
+    INCLIN inclin = DEFAULT_INCLIN;
+    STATE state = DEFAULT_STATE;
+    bool operator==(const TraceOp& rhs) const;
+};
+
+class TraceWriter{
+    public:
+    TraceWriter();
+    ~TraceWriter();
+    // truncates the file and writes the header, minID and maxID are the range of the recorded network
+    bool open(const string& fileName, SatID minID = INT64_MIN, SatID maxID = INT64_MAX);
+    void write(const TraceOp& op);
+    bool close();// flushes the buffer and closes the file, false if any write failed
+    bool isOpen() const {return m_file != nullptr;}
+    long long getCount() const {return m_count;}
+    private:
+    void flush();
+    FILE* m_file;
+    vector<unsigned char> m_buffer;
+    SatID m_lastID;
+    long long m_count;
+    bool m_failed;  //a write came up short since open
+};
+
+class TraceReader{
+    public:
+    TraceReader();
+    ~TraceReader();
+    bool open(const string& fileName);// false if the file is missing or not a trace
+    bool next(TraceOp& op);// false at the end of the trace or on a truncated record
+    void close();
+    SatID getMinID() const {return m_minID;}// the id range of the recorded network
+    SatID getMaxID() const {return m_maxID;}
+    private:
+    bool refill();
+    int getByte();
+    FILE* m_file;
+    vector<unsigned char> m_buffer;
+    size_t m_pos;
+    size_t m_size;
+    SatID m_lastID;
+    SatID m_minID;
+    SatID m_maxID;
+};
+
+// reads a whole trace into ops, returns false if the file can't be read
+bool readTrace(const string& fileName, vector<TraceOp>& ops);
+// also reads the id range the trace was recorded with
+bool readTrace(const string& fileName, vector<TraceOp>& ops, SatID& minID, SatID& maxID);
+// writes ops as a trace of a network with the range minID - maxID, returns false if the file can't be written
+bool writeTrace(const string& fileName, const vector<TraceOp>& ops, SatID minID = INT64_MIN, SatID maxID = INT64_MAX);
+// performs a single operation on the network
+void applyTraceOp(SatNet& network, const TraceOp& op);
+// performs every operation in order at full speed, returns the elapsed time in ns
+long long replayTrace(SatNet& network, const vector<TraceOp>& ops);
+string traceOpStr(TRACEOP op);
+
+// appends the record of op to out, lastID is the id of the previous record and is updated
+void encodeTraceOp(const TraceOp& op, SatID& lastID, vector<unsigned char>& out);
+// decodes one record, getByte returns the next byte or -1 at the end of the input. Returns false at
+// the end of the input or on a broken record.
+template <class GetByte>
+bool decodeTraceOp(GetByte getByte, SatID& lastID, TraceOp& op){
+    int head = getByte();
+    if (head < 0 || (head & 7) >= NUM_TRACEOPS){
+        return false;
+    }
+    op = TraceOp();
+    op.op = static_cast<TRACEOP>(head & 7);
+    if (op.op == T_SETSTATE){
+        op.state = static_cast<STATE>((head >> 3) & 3);
+    }
+    if (op.op == T_INSERT){
+        int attributes = getByte();
+        if (attributes < 0){
+            return false;
+        }
+        op.alt = static_cast<ALT>(attributes & 3);
+        op.inclin = static_cast<INCLIN>((attributes >> 2) & 3);
+        op.state = static_cast<STATE>((attributes >> 4) & 3);
+    }
+    if (op.op != T_REMOVEDEORBITED){
+        uint64_t zigzag = 0;
+        int shift = 0;
+        int byte = 0;
+        do {
+            byte = getByte();
+            if (byte < 0 || shift > 63){
+                return false;
+            }
+            zigzag |= uint64_t(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        uint64_t delta = (zigzag >> 1) ^ (0 - (zigzag & 1));
+        op.id = SatID(uint64_t(lastID) + delta);
+        lastID = op.id;
+    }
+    return true;
+}
+#endif
@@ -0,0 +1,172 @@
+// Title: workload.cpp
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: This is the implementation file for workload.h
+
+#include "workload.h"
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+// the resolution used to turn the integer Random into a uniform number in [0, 1)
+const int UNIFORM_STEPS = 1000000000;
+// the largest weight parse takes, five of them still add up to an int
+const long MAX_MIX_WEIGHT = 100000000;
+
+// Name - parse(const string& text)
+// Desc - Reads five comma separated weights of at most MAX_MIX_WEIGHT, returns false and keeps the
+// old mix on bad input. Out of range numbers are refused instead of throwing from the command line.
+bool WorkloadMix::parse(const string& text){
+    int weights[5] = {0};
+    stringstream in(text);
+    string field;
+    int count = 0;
+    while (getline(in, field, ',')){
+        if (count == 5 || field.empty() || field.find_first_not_of("0123456789") != string::npos){
+            return false;
+        }
+        // all digits, so only the length can make it too big
+        long weight = field.size() > 9 ? MAX_MIX_WEIGHT + 1 : strtol(field.c_str(), nullptr, 10);
+        if (weight > MAX_MIX_WEIGHT){
+            return false;
+        }
+        weights[count++] = weight;
+    }
+    if (count != 5 || weights[0] + weights[1] + weights[2] + weights[3] + weights[4] == 0){
+        return false;
+    }
+    find = weights[0];
+    setState = weights[1];
+    insert = weights[2];
+    remove = weights[3];
+    removeDeorbited = weights[4];
+    return true;
+}
+
+// Name - toString()
+// Desc - the mix in the format read by parse
+string WorkloadMix::toString() const {
+    return to_string(find) + "," + to_string(setState) + "," + to_string(insert) + "," +
+           to_string(remove) + "," + to_string(removeDeorbited);
+}
+
+// Name - ZipfGenerator(int n, double theta, int seed)
+// Desc - precomputes the zeta constants, this is O(n) once
+ZipfGenerator::ZipfGenerator(int n, double theta, int seed) : m_uniform(0, UNIFORM_STEPS - 1) {
+    m_n = n < 1 ? 1 : n;
+    m_theta = theta;
+    m_uniform.setSeed(seed);
+    m_zetan = 0;
+    for (int i = 1; i <= m_n; i++){
+        m_zetan += 1.0 / pow(i, m_theta);
+    }
+    double zeta2 = 1.0 + 1.0 / pow(2, m_theta);
+    m_alpha = 1.0 / (1.0 - m_theta);
+    m_eta = (1.0 - pow(2.0 / m_n, 1.0 - m_theta)) / (1.0 - zeta2 / m_zetan);
+}
+
+// Name - next()
+// Desc - the next rank, 0 is the hottest
+int ZipfGenerator::next(){
+    double u = double(m_uniform.getRandNum()) / UNIFORM_STEPS;
+    double uz = u * m_zetan;
+    if (uz < 1.0){
+        return 0;
+    }
+    if (uz < 1.0 + pow(0.5, m_theta)){
+        return 1;
+    }
+    int rank = static_cast<int>(m_n * pow(m_eta * u - m_eta + 1.0, m_alpha));
+    return rank >= m_n ? m_n - 1 : rank;
+}
+
+// Name - mixWeight(const WorkloadMix& mix)
+// Desc - the sum of the weights of a mix
+static int mixWeight(const WorkloadMix& mix){
+    return mix.find + mix.setState + mix.insert + mix.remove + mix.removeDeorbited;
+}
+
+// Name - Workload(const WorkloadMix& mix, int keyCount, double theta, int seed, SatID minID)
+// Desc - sets up the generators, the same arguments always produce the same operations. A mix
+// without any weight is replaced by the default mix.
+Workload::Workload(const WorkloadMix& mix, int keyCount, double theta, int seed, SatID minID)
+    : m_mix(mixWeight(mix) > 0 ? mix : WorkloadMix()), m_keyCount(keyCount < 1 ? 1 : keyCount), m_minID(minID),
+      m_totalWeight(mixWeight(m_mix)), m_zipf(m_keyCount, theta, seed), m_opGen(0, m_totalWeight - 1),
+      m_keyGen(0, 2 * m_keyCount - 1), m_attrGen(0, 3) {
+    m_opGen.setSeed(seed + 1);
+    m_keyGen.setSeed(seed + 2);
+    m_attrGen.setSeed(seed + 3);
+}
+
+// Name - hotID()
+// Desc - a Zipfian rank scattered over the loaded ids with a multiplicative hash, so the hot
+// satellites are spread through the tree instead of sitting in the leftmost subtree
+SatID Workload::hotID(){
+    uint64_t rank = m_zipf.next();
+    uint64_t scattered = (rank * 0x9E3779B97F4A7C15ULL) >> 16;
+    return m_minID + SatID(scattered % m_keyCount);
+}
+
+// Name - makeInsert(SatID id)
+// Desc - an insert with random attributes, a quarter of them already deorbited
+TraceOp Workload::makeInsert(SatID id){
+    TraceOp op;
+    op.op = T_INSERT;
+    op.id = id;
+    op.alt = static_cast<ALT>(m_attrGen.getRandNum());
+    op.inclin = static_cast<INCLIN>(m_attrGen.getRandNum());
+    op.state = m_attrGen.getRandNum() == 0 ? DEORBITED : ACTIVE;
+    return op;
+}
+
+// Name - load(vector<TraceOp>& ops)
+// Desc - appends the inserts of the initial catalog in a shuffled order
+void Workload::load(vector<TraceOp>& ops){
+    Random shuffler(0, m_keyCount - 1, SHUFFLE);
+    shuffler.setSeed(m_keyCount);
+    vector<int> order;
+    shuffler.getShuffle(order);
+    for (size_t i = 0; i < order.size(); i++){
+        TraceOp op = makeInsert(m_minID + order[i]);
+        op.state = ACTIVE;
+        ops.push_back(op);
+    }
+}
+
+// Name - next()
+// Desc - picks an operation by weight, find and setState go to hot ids and inserts and removes
+// pick uniformly from twice the loaded ids
+TraceOp Workload::next(){
+    int pick = m_opGen.getRandNum();
+    TraceOp op;
+    if ((pick -= m_mix.find) < 0){
+        op.op = T_FIND;
+        op.id = hotID();
+    }
+    else if ((pick -= m_mix.setState) < 0){
+        op.op = T_SETSTATE;
+        op.id = hotID();
+        // most state changes are decay, some deorbit and some recover
+        int roll = m_attrGen.getRandNum();
+        op.state = roll < 2 ? DECAYING : (roll == 2 ? DEORBITED : ACTIVE);
+    }
+    else if ((pick -= m_mix.insert) < 0){
+        op = makeInsert(m_minID + m_keyGen.getRandNum());
+    }
+    else if ((pick -= m_mix.remove) < 0){
+        op.op = T_REMOVE;
+        op.id = m_minID + m_keyGen.getRandNum();
+    }
+    else {
+        op.op = T_REMOVEDEORBITED;
+    }
+    return op;
+}
+
+// Name - generate(int count, vector<TraceOp>& ops)
+// Desc - appends the next count operations of the mix
+void Workload::generate(int count, vector<TraceOp>& ops){
+    for (int i = 0; i < count; i++){
+        ops.push_back(next());
+    }
+}
@@ -0,0 +1,67 @@
+// Title: workload.h
+// Author: Andrew Tang
+// Date: 10/18/2026
+// Description: YCSB style workload generator for SatNet. A workload loads a catalog and then
+// produces a configurable mix of find, setState, insert, remove and removeDeorbited calls with
+// Zipfian hot ids, as TraceOp records that can be applied directly or written to a trace.
+
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+#include "satnet.h"
+#include "random.h"
+#include "trace.h"
+#include <string>
+#include <vector>
+using namespace std;
+
+// the relative weights of the operations in a workload, they don't need to add up to 100
+struct WorkloadMix{
+    int find = 50;
+    int setState = 30;
+    int insert = 10;
+    int remove = 9;
+    int removeDeorbited = 1;
+    // reads "find,setState,insert,remove,removeDeorbited", e.g. "50,30,10,9,1"
+    bool parse(const string& text);
+    string toString() const;
+};
+
+// draws ranks in [0, n) where rank 0 is the most popular, following the algorithm used by YCSB
+// (Gray et al., "Quickly generating billion-record synthetic databases")
+class ZipfGenerator{
+    public:
+    ZipfGenerator(int n, double theta = 0.99, int seed = 10);// theta in (0, 1), larger is more skewed
+    int next();
+    private:
+    int m_n;
+    double m_theta;
+    double m_alpha;
+    double m_zetan;
+    double m_eta;
+    Random m_uniform;
+};
+
+class Workload{
+    public:
+    // keyCount satellites are loaded with ids minID, minID + 1, ... and inserts and removes use
+    // twice that many ids, so a network for the workload needs the range minID - maxID()
+    Workload(const WorkloadMix& mix, int keyCount, double theta = 0.99, int seed = 10, SatID minID = MINID);
+    SatID maxID() const {return m_minID + 2 * SatID(m_keyCount) - 1;}
+    // the inserts of the initial catalog, in a shuffled order
+    void load(vector<TraceOp>& ops);
+    // the next operation of the mix
+    TraceOp next();
+    void generate(int count, vector<TraceOp>& ops);
+    private:
+    SatID hotID();// a loaded id picked with the Zipfian distribution, scattered over the catalog
+    TraceOp makeInsert(SatID id);
+    WorkloadMix m_mix;
+    int m_keyCount;
+    SatID m_minID;
+    int m_totalWeight;
+    ZipfGenerator m_zipf;
+    Random m_opGen;
+    Random m_keyGen;
+    Random m_attrGen;
+};
+#endif